@@ -0,0 +1,983 @@
+#!/usr/bin/env python3
+#
+# Generates dispatcher.hpp and vkh.hpp from the Vulkan registry (vk.xml).
+#
+# Usage: vkgen.py --registry path/to/vk.xml --output path/to/directory
+#
+
+import argparse
+import pathlib
+import xml.etree.ElementTree as ET
+
+NO_SLOT = 0xFFFF
+
+# The hot section is aligned to a cache line and must fit in two of them. The alignment carries over to
+# the dispatcher, so heap-allocated dispatchers rely on the aligned operator new of C++17.
+HOT_SLOTS = 16
+
+INSTANCE_HANDLES = ('VkInstance', 'VkPhysicalDevice')
+DEVICE_HANDLES = ('VkDevice', 'VkQueue', 'VkCommandBuffer')
+
+# Handle structs in vkh.hpp, in the order they are emitted.
+VKH_HANDLES = (
+    ('VkQueue', 'queue'),
+    ('VkDevice', 'device'),
+    ('VkInstance', 'instance'),
+    ('VkCommandBuffer', 'commandBuffer'),
+    ('VkPhysicalDevice', 'physicalDevice'),
+)
+
+
+def api_matches(element):
+    api = element.get('api')
+    return api is None or 'vulkan' in api.split(',')
+
+
+def fnv1a(name, seed):
+    value = (2166136261 ^ seed) & 0xFFFFFFFF
+    for byte in name.encode():
+        value ^= byte
+        value = (value * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def perfect_hash(names):
+    """Hash-and-displace: every bucket gets the smallest seed that places all of its names in free slots."""
+    count = len(names)
+    buckets = max(1, count // 4)
+    groups = [[] for _ in range(buckets)]
+    for index, name in enumerate(names):
+        groups[fnv1a(name, 0) % buckets].append(index)
+
+    seeds = [0] * buckets
+    table = [None] * count
+    for bucket in sorted(range(buckets), key=lambda bucket: -len(groups[bucket])):
+        if not groups[bucket]:
+            continue
+        for seed in range(1, 0x10000):
+            positions = [fnv1a(names[index], seed) % count for index in groups[bucket]]
+            if len(set(positions)) == len(positions) and all(table[position] is None for position in positions):
+                break
+        else:
+            raise RuntimeError(f'no perfect hash seed for bucket {bucket}')
+        seeds[bucket] = seed
+        for index, position in zip(groups[bucket], positions):
+            table[position] = index
+    return seeds, table
+
+
+class Param:
+    def __init__(self, element):
+        type_element = element.find('type')
+        name_element = element.find('name')
+        prefix = element.text or ''
+        pointer = (type_element.tail or '').replace(' ', '').replace('const', ' const')
+        suffix = name_element.tail or ''
+        for child in list(element)[list(element).index(name_element) + 1:]:
+            suffix += (child.text or '') + (child.tail or '')
+
+        self.type = type_element.text
+        self.name = name_element.text
+        self.decl = f'{self.type}{" const" if "const" in prefix else ""}{pointer} {self.name}{suffix.strip()}'
+
+
+class Command:
+    def __init__(self, name, return_type, params):
+        self.name = name
+        self.return_type = return_type
+        self.params = params
+        self.alias = None       # next command that provides the same entry point
+        self.groups = []        # features and extensions that require this command
+        self.level = None
+        self.slot = None
+
+    @property
+    def handle(self):
+        return self.params[0].type if self.params else None
+
+    @property
+    def protect(self):
+        protects = {group.protect for group in self.groups}
+        if None in protects:
+            return None
+        return ' || '.join(f'defined( {protect} )' for protect in sorted(protects))
+
+
+class Group:
+    def __init__(self, name, protect, commands):
+        self.name = name
+        self.protect = protect
+        self.commands = commands
+
+
+HOT_GROUP = Group('hot: first two cache lines', None, [])
+
+
+class Registry:
+    def __init__(self, path):
+        root = ET.parse(path).getroot()
+
+        self.header_version = None
+        for element in root.findall('types/type'):
+            name = element.find('name')
+            if api_matches(element) and name is not None and name.text == 'VK_HEADER_VERSION':
+                self.header_version = int(name.tail.strip())
+
+        platforms = {element.get('name'): element.get('protect') for element in root.findall('platforms/platform')}
+
+        self.commands = {}
+        aliases = []
+        for element in root.findall('commands/command'):
+            if not api_matches(element):
+                continue
+            if element.get('alias'):
+                aliases.append((element.get('name'), element.get('alias')))
+                continue
+            proto = element.find('proto')
+            params = [Param(param) for param in element.findall('param') if api_matches(param)]
+            name = proto.find('name').text
+            self.commands[name] = Command(name, proto.find('type').text, params)
+        for name, target in aliases:
+            origin = self.commands[target]
+            self.commands[name] = Command(name, origin.return_type, origin.params)
+
+        self.groups = []
+        for element in root.findall('feature'):
+            if api_matches(element):
+                self.groups.append(Group(element.get('name'), None, self.required(element)))
+        for element in root.findall('extensions/extension'):
+            if 'vulkan' not in element.get('supported', '').split(','):
+                continue
+            protect = platforms.get(element.get('platform'))
+            if protect is None and element.get('provisional') == 'true':
+                protect = 'VK_ENABLE_BETA_EXTENSIONS'
+            self.groups.append(Group(element.get('name'), protect, self.required(element)))
+
+        for group in self.groups:
+            for name in group.commands:
+                if group not in self.commands[name].groups:
+                    self.commands[name].groups.append(group)
+
+        for command in self.commands.values():
+            if command.handle in INSTANCE_HANDLES:
+                command.level = 'Instance'
+            elif command.handle in DEVICE_HANDLES:
+                command.level = 'Device'
+            else:
+                command.level = 'Context'
+        # vkGetInstanceProcAddr takes a VkInstance but is the entry point every dispatcher starts from.
+        self.commands['vkGetInstanceProcAddr'].level = 'Context'
+
+        # Chain every promoted name behind the command it was promoted to, so a slot can fall back to
+        # the extension name when the core version is not enabled.
+        chains = {}
+        for name, target in aliases:
+            if self.commands[name].groups and self.commands[target].groups:
+                chains.setdefault(target, []).append(name)
+        for target, names in chains.items():
+            chain = [target] + names
+            for current, following in zip(chain, chain[1:]):
+                self.commands[current].alias = following
+
+    def required(self, element):
+        names = []
+        for require in element.findall('require'):
+            if not api_matches(require):
+                continue
+            for command in require.findall('command'):
+                if command.get('name') not in names:
+                    names.append(command.get('name'))
+        return names
+
+    def level(self, level, first, hot=()):
+        """Returns (sections, commands, features) for one dispatcher.
+
+        The getter and the hot commands come first, in a section of their own; every other command is
+        listed under the first group requiring it.
+        """
+        hot = [name for name in hot if name in self.commands and self.commands[name].level == level and self.commands[name].groups]
+        if len(hot) + 1 > HOT_SLOTS:
+            raise RuntimeError(f'{len(hot)} hot {level.lower()} commands do not fit in {HOT_SLOTS - 1} slots')
+        for name in hot:
+            if self.commands[name].protect:
+                raise RuntimeError(f'hot command {name} is platform specific')
+
+        seen = set()
+        sections = []
+        if hot:
+            seen.update([first] + hot)
+            sections.append((HOT_GROUP, [self.commands[name] for name in [first] + hot]))
+        for group in self.groups:
+            names = [name for name in group.commands if name not in seen and self.commands[name].level == level]
+            seen.update(names)
+            if first is not None and first in names:
+                names.remove(first)
+                names.insert(0, first)
+            if names:
+                sections.append((group, [self.commands[name] for name in names]))
+        commands = [command for _, commands in sections for command in commands]
+        for slot, command in enumerate(commands):
+            command.slot = slot
+        features = []
+        for command in commands:
+            for group in command.groups:
+                if group.name not in features:
+                    features.append(group.name)
+        return sections, commands, features
+
+
+def guard_runs(commands):
+    """Splits commands into consecutive runs that share a preprocessor guard."""
+    runs = []
+    for command in commands:
+        if runs and runs[-1][0] == command.protect:
+            runs[-1][1].append(command)
+        else:
+            runs.append((command.protect, [command]))
+    return runs
+
+
+def emit_members(out, sections):
+    for group, commands in sections:
+        out.append('')
+        out.append(f'    //=== {group.name} ===')
+        for protect, run in guard_runs(commands):
+            width = max(len(f'PFN_{command.name}') for command in run)
+            names = max(len(command.name) for command in run)
+            if protect:
+                out.append(f'#  if {protect}')
+            for command in run:
+                if group is HOT_GROUP and command.slot == 0:
+                    out.append('    // Makes the dispatcher 64-byte aligned; new relies on the aligned operator new for it.')
+                    out.append('    alignas( 64 )')
+                out.append(f'    {f"PFN_{command.name}":<{width}} {command.name:<{names}} = nullptr;')
+            if protect:
+                out.append('#  else')
+                for command in run:
+                    out.append(f'    PFN_dummy {command.name}_placeholder = nullptr;')
+                out.append(f'#  endif')
+
+
+def emit_tables(out, prefix, commands, features):
+    feature_index = {name: index for index, name in enumerate(features)}
+    flattened = []
+    ranges = []
+    for command in commands:
+        begin = len(flattened)
+        flattened.extend(feature_index[group.name] for group in command.groups)
+        ranges.append((begin, len(flattened)))
+
+    out.append(f'inline constexpr auto {prefix}FeatureNames = std::array<std::string_view, {len(features)}>{{')
+    for name in features:
+        out.append(f'    "{name}",')
+    out.append('};')
+    out.append('')
+    out.append(f'inline constexpr auto {prefix}CommandFeatures = std::array<u16, {len(flattened)}>{{')
+    for begin in range(0, len(flattened), 16):
+        out.append('    ' + ', '.join(str(index) for index in flattened[begin:begin + 16]) + ',')
+    out.append('};')
+    out.append('')
+    out.append(f'inline constexpr auto {prefix}Commands = std::array<VkDispatchCommand, {len(commands)}>{{')
+    for command, (begin, end) in zip(commands, ranges):
+        alias = 'VkNoSlot' if command.alias is None else str(next(c.slot for c in commands if c.name == command.alias))
+        out.append(f'    VkDispatchCommand{{ "{command.name}", {alias}, {begin}, {end} }},')
+    out.append('};')
+    out.append('')
+    seeds, table = perfect_hash([command.name for command in commands])
+    out.append(f'inline constexpr auto {prefix}CommandHash = VkDispatchHash<{len(commands)}, {len(seeds)}>{{')
+    out.append('    .seeds = {')
+    for begin in range(0, len(seeds), 16):
+        out.append('        ' + ', '.join(str(seed) for seed in seeds[begin:begin + 16]) + ',')
+    out.append('    },')
+    out.append('    .slots = {')
+    for begin in range(0, len(table), 16):
+        out.append('        ' + ', '.join(str(slot) for slot in table[begin:begin + 16]) + ',')
+    out.append('    },')
+    out.append('};')
+
+
+def emit_stubs(out, cls, function, template, commands):
+    out.append(f'inline auto {cls}::{function}( u16 slot ) -> PFN_vkVoidFunction')
+    out.append('{')
+    out.append(f'    static PFN_vkVoidFunction const stubs[] = {{')
+    for protect, run in guard_runs(commands):
+        if protect:
+            out.append(f'#  if {protect}')
+        for command in run:
+            out.append(f'        PFN_vkVoidFunction( &{template}<&{cls}::{command.name}, {command.slot}>::invoke ),')
+        if protect:
+            out.append('#  else')
+            for command in run:
+                out.append('        nullptr,')
+            out.append('#  endif')
+    out.append('    };')
+    out.append('    return stubs[slot];')
+    out.append('}')
+
+
+PRELUDE = '''\
+//
+// Generated by scripts/vkgen.py from the Vulkan registry. Do not edit.
+//
+
+#pragma once
+
+#define VK_NO_PROTOTYPES
+#define VK_ENABLE_BETA_EXTENSIONS
+#include "vulkan/vulkan.h"
+
+#include "pch.hpp"
+
+static_assert( VK_HEADER_VERSION == {header_version}, "dispatcher.hpp was generated from a different vk.xml than vulkan.h" );
+
+using PFN_dummy = void ( * )();
+
+enum class VkDispatchMode {{
+    // Every entry point is resolved in the constructor.
+    Eager,
+    // Every entry point starts as a stub that resolves and patches its own slot on first call. Slots are
+    // patched with relaxed atomic stores and the vkh.hpp trampolines read them with relaxed atomic loads,
+    // but calls made straight through the members are plain loads, so a dispatcher that several threads
+    // call through directly must be warm()ed on one thread first.
+    Lazy,
+    // Every entry point is resolved in the constructor and called through a shim that records its
+    // latency in VkDispatchProfile.
+    Profile,
+}};
+
+// Core versions and extensions whose entry points a dispatcher resolves. The default selects everything;
+// entry points of features that are not selected stay null.
+struct VkDispatchFeatures {{
+    u32                                         apiVersion = std::numeric_limits<u32>::max();
+    std::optional<std::span<char const* const>> extensions = std::nullopt;
+
+    auto contains( std::string_view feature ) const -> bool {{
+        if ( feature.starts_with( "VK_VERSION_" ) ) {{
+            auto major = u32( feature[11] - '0' );
+            auto minor = u32( feature[13] - '0' );
+            return VK_MAKE_API_VERSION( 0, major, minor, 0 ) <= apiVersion;
+        }}
+        if ( !extensions ) {{
+            return true;
+        }}
+        return std::ranges::any_of( *extensions, [feature]( char const* extension ) {{ return feature == extension; }} );
+    }}
+}};
+
+inline constexpr u16 VkNoSlot = 0xFFFF;
+
+// One row of a generated command table. Features [featureBegin, featureEnd) index the matching
+// *CommandFeatures table; alias is the slot of the next name that provides the same entry point.
+struct VkDispatchCommand {{
+    std::string_view name;
+    u16              alias;
+    u16              featureBegin;
+    u16              featureEnd;
+}};
+
+constexpr auto VkDispatchHashName( std::string_view name, u32 seed ) -> u32 {{
+    auto value = u32( 2166136261u ^ seed );
+    for ( auto c : name ) {{
+        value ^= u8( c );
+        value *= 16777619u;
+    }}
+    return value;
+}}
+
+// Minimal perfect hash over the command names of one dispatcher, built by the generator.
+template<usize Count, usize Buckets>
+struct VkDispatchHash {{
+    std::array<u16, Buckets> seeds;
+    std::array<u16, Count>   slots;
+
+    constexpr auto find( std::span<VkDispatchCommand const, Count> commands, std::string_view name ) const -> u16 {{
+        auto seed = seeds[VkDispatchHashName( name, 0 ) % Buckets];
+        auto slot = slots[VkDispatchHashName( name, seed ) % Count];
+        return commands[slot].name == name ? slot : VkNoSlot;
+    }}
+}};
+
+// Dispatchable handles start with the loader dispatch table pointer, which is shared by every
+// object created from the same instance or device, so it identifies the owning dispatcher.
+template<typename Handle>
+inline auto VkDispatchKey( Handle handle ) -> void* {{
+    return *reinterpret_cast<void**>( handle );
+}}
+
+// Every live dispatcher, keyed by dispatch key. Lookups are lock-free because lazy stubs and the
+// vkh.hpp trampolines take one on every call; inserts and erases are serialized.
+template<typename Dispatcher>
+class VkDispatchRegistry {{
+public:
+    static void insert( void* key, Dispatcher* dispatcher ) {{
+        std::lock_guard lock( mutex );
+        for ( auto& entry : entries ) {{
+            if ( entry.dispatcher.load( std::memory_order_relaxed ) == nullptr ) {{
+                entry.dispatcher.store( dispatcher, std::memory_order_relaxed );
+                entry.key.store( key, std::memory_order_release );
+                return;
+            }}
+        }}
+        std::println( stderr, "[error]: more than {{}} live dispatchers of one type", entries.size() );
+        std::abort();
+    }}
+
+    static void erase( Dispatcher* dispatcher ) {{
+        std::lock_guard lock( mutex );
+        for ( auto& entry : entries ) {{
+            if ( entry.dispatcher.load( std::memory_order_relaxed ) == dispatcher ) {{
+                entry.key.store( nullptr, std::memory_order_relaxed );
+                entry.dispatcher.store( nullptr, std::memory_order_release );
+            }}
+        }}
+    }}
+
+    static auto find( void* key ) -> Dispatcher* {{
+        for ( auto& entry : entries ) {{
+            if ( entry.key.load( std::memory_order_acquire ) == key ) {{
+                return entry.dispatcher.load( std::memory_order_relaxed );
+            }}
+        }}
+        return nullptr;
+    }}
+
+private:
+    struct Entry {{
+        std::atomic<void*>       key        = nullptr;
+        std::atomic<Dispatcher*> dispatcher = nullptr;
+    }};
+
+    static inline std::mutex            mutex;
+    static inline std::array<Entry, 16> entries;
+}};
+
+template<auto Member, u16 Slot>
+struct VkLazyStub;
+
+// Resolves the slot (falling back along its alias chain), stores the result over the stub and forwards
+// the call. Later calls go straight through the patched slot.
+template<typename Dispatcher, typename R, typename Handle, typename... Args, R ( VKAPI_PTR* Dispatcher::*Member )( Handle, Args... ), u16 Slot>
+struct VkLazyStub<Member, Slot> {{
+    using Function = R ( VKAPI_PTR* )( Handle, Args... );
+
+    static VKAPI_ATTR auto VKAPI_CALL invoke( Handle handle, Args... args ) -> R {{
+        auto* dispatcher = VkDispatchRegistry<Dispatcher>::find( VkDispatchKey( handle ) );
+        assert( dispatcher != nullptr );
+
+        auto function = Function( dispatcher->resolve( Slot ) );
+        assert( function != nullptr );
+
+        std::atomic_ref( dispatcher->*Member ).store( function, std::memory_order_relaxed );
+        return function( handle, args... );
+    }}
+}};
+
+// Call latency histograms of one dispatcher type. Every thread records into its own buffer with plain
+// relaxed stores; buffers are pushed onto a lock-free list on first use and never freed, so dump() can
+// walk them at any time, including after their threads have exited.
+template<typename Dispatcher, usize Count>
+class VkDispatchProfile {{
+public:
+    // Bucket b counts calls that took less than 2^b nanoseconds; the last bucket takes everything slower.
+    static constexpr usize Buckets = 24;
+
+    static void record( u16 slot, u64 nanoseconds ) {{
+        auto& buffer = local();
+        auto& bucket = buffer.histogram[slot][std::min<usize>( std::bit_width( nanoseconds ), Buckets - 1 )];
+        bucket.store( bucket.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+        auto& total = buffer.nanoseconds[slot];
+        total.store( total.load( std::memory_order_relaxed ) + nanoseconds, std::memory_order_relaxed );
+    }}
+
+    static void dump( std::FILE* stream, std::span<VkDispatchCommand const, Count> commands ) {{
+        struct Row {{
+            u16                      slot        = 0;
+            u64                      calls       = 0;
+            u64                      nanoseconds = 0;
+            std::array<u64, Buckets> histogram   = {{}};
+        }};
+
+        auto rows = std::vector<Row>( Count );
+        for ( auto* buffer = head.load( std::memory_order_acquire ); buffer != nullptr; buffer = buffer->next ) {{
+            for ( usize slot = 0; slot < Count; slot += 1 ) {{
+                rows[slot].slot = u16( slot );
+                rows[slot].nanoseconds += buffer->nanoseconds[slot].load( std::memory_order_relaxed );
+                for ( usize bucket = 0; bucket < Buckets; bucket += 1 ) {{
+                    auto calls = buffer->histogram[slot][bucket].load( std::memory_order_relaxed );
+                    rows[slot].histogram[bucket] += calls;
+                    rows[slot].calls += calls;
+                }}
+            }}
+        }}
+        std::erase_if( rows, []( Row const& row ) {{ return row.calls == 0; }} );
+        std::ranges::sort( rows, std::greater(), &Row::nanoseconds );
+
+        auto percentile = []( Row const& row, f64 fraction ) -> u64 {{
+            auto calls = u64( 0 );
+            for ( usize bucket = 0; bucket < Buckets; bucket += 1 ) {{
+                calls += row.histogram[bucket];
+                if ( f64( calls ) >= fraction * f64( row.calls ) ) {{
+                    return u64( 1 ) << bucket;
+                }}
+            }}
+            return u64( 1 ) << ( Buckets - 1 );
+        }};
+
+        std::println( stream, "{{:<48}} {{:>12}} {{:>14}} {{:>10}} {{:>10}} {{:>10}}", "entry point", "calls", "total us", "mean ns", "<p50 ns", "<p99 ns" );
+        for ( auto const& row : rows ) {{
+            std::println( stream, "{{:<48}} {{:>12}} {{:>14.1f}} {{:>10}} {{:>10}} {{:>10}}",
+                commands[row.slot].name,
+                row.calls,
+                f64( row.nanoseconds ) / 1e3,
+                row.nanoseconds / row.calls,
+                percentile( row, 0.50 ),
+                percentile( row, 0.99 ) );
+        }}
+    }}
+
+private:
+    struct Buffer {{
+        std::array<std::array<std::atomic<u64>, Buckets>, Count> histogram   = {{}};
+        std::array<std::atomic<u64>, Count>                      nanoseconds = {{}};
+        Buffer*                                                  next        = nullptr;
+    }};
+
+    static auto local() -> Buffer& {{
+        thread_local auto* buffer = attach();
+        return *buffer;
+    }}
+
+    static auto attach() -> Buffer* {{
+        auto* buffer = new Buffer();
+        buffer->next = head.load( std::memory_order_relaxed );
+        while ( !head.compare_exchange_weak( buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed ) ) {{
+        }}
+        return buffer;
+    }}
+
+    static inline std::atomic<Buffer*> head = nullptr;
+}};
+
+template<auto Member, u16 Slot>
+struct VkProfileShim;
+
+// Times the resolved entry point behind a slot. The dispatcher is found the same way as for the lazy stubs.
+template<typename Dispatcher, typename R, typename Handle, typename... Args, R ( VKAPI_PTR* Dispatcher::*Member )( Handle, Args... ), u16 Slot>
+struct VkProfileShim<Member, Slot> {{
+    using Function = R ( VKAPI_PTR* )( Handle, Args... );
+
+    static VKAPI_ATTR auto VKAPI_CALL invoke( Handle handle, Args... args ) -> R {{
+        auto* dispatcher = VkDispatchRegistry<Dispatcher>::find( VkDispatchKey( handle ) );
+        assert( dispatcher != nullptr );
+
+        auto function = Function( dispatcher->targets[Slot] );
+        auto start    = std::chrono::steady_clock::now();
+        if constexpr ( std::is_void_v<R> ) {{
+            function( handle, args... );
+            Dispatcher::Profile::record( Slot, u64( std::chrono::nanoseconds( std::chrono::steady_clock::now() - start ).count() ) );
+        }} else {{
+            auto result = function( handle, args... );
+            Dispatcher::Profile::record( Slot, u64( std::chrono::nanoseconds( std::chrono::steady_clock::now() - start ).count() ) );
+            return result;
+        }}
+    }}
+}};
+'''
+
+CONTEXT = '''\
+class VkContextDispatcher {{
+public:
+    VkContextDispatcher(PFN_vkGetInstanceProcAddr getProcAddr)
+        : vkGetInstanceProcAddr(getProcAddr)
+{initializers} {{
+        current.store(this, std::memory_order_release);
+    }}
+
+    VkContextDispatcher(VkContextDispatcher const&) = delete;
+    auto operator=(VkContextDispatcher const&) -> VkContextDispatcher& = delete;
+
+    ~VkContextDispatcher() {{
+        current.store(nullptr, std::memory_order_release);
+    }}
+public:
+    // Global commands have no handle to look a dispatcher up by, so the vkh.hpp trampolines use the last one created.
+    static inline std::atomic<VkContextDispatcher*> current = nullptr;
+
+    PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = nullptr;
+{members}
+}};
+'''
+
+DISPATCHER = '''\
+class {cls} {{
+public:
+    {cls}( {getter_type} getProcAddr, {handle_type} {handle}, VkDispatchMode mode = VkDispatchMode::Eager );
+    {cls}( {getter_type} getProcAddr, {handle_type} {handle}, VkDispatchFeatures const& features, VkDispatchMode mode = VkDispatchMode::Eager );
+
+    {cls}( {cls} const& ) = delete;
+    auto operator=( {cls} const& ) -> {cls}& = delete;
+
+    ~{cls}();
+
+    auto resolve( char const* name ) const -> PFN_vkVoidFunction
+    {{
+        return {getter}( {handle}, name );
+    }}
+
+    // Resolves the entry point of a slot, trying each enabled name along its alias chain.
+    auto resolve( u16 slot ) const -> PFN_vkVoidFunction;
+
+    // Replaces every lazy stub that has not been called yet with its entry point; does nothing in other modes.
+    void warm();
+
+    // Every entry point of this dispatcher, indexed like {prefix}Commands.
+    auto slots() -> std::span<PFN_vkVoidFunction, {count}>
+    {{
+        return std::span<PFN_vkVoidFunction, {count}>( reinterpret_cast<PFN_vkVoidFunction*>( &{first} ), {count} );
+    }}
+
+    auto find( std::string_view name ) -> PFN_vkVoidFunction*
+    {{
+        auto slot = {prefix}CommandHash.find( {prefix}Commands, name );
+        return slot != VkNoSlot ? &slots()[slot] : nullptr;
+    }}
+
+    using Profile = VkDispatchProfile<{cls}, {count}>;
+
+    // Prints the calls recorded so far by every {cls} in VkDispatchMode::Profile.
+    static void dumpProfile( std::FILE* stream )
+    {{
+        Profile::dump( stream, {prefix}Commands );
+    }}
+
+private:
+    auto enabled( u16 slot ) const -> bool
+    {{
+        auto const& command = {prefix}Commands[slot];
+        for ( auto index = command.featureBegin; index < command.featureEnd; index += 1 ) {{
+            if ( enabledFeatures[{prefix}CommandFeatures[index]] ) {{
+                return true;
+            }}
+        }}
+        return false;
+    }}
+
+    // Lazy stub and profiling shim of a slot, or null when the entry point is compiled out on this platform.
+    static auto stub( u16 slot ) -> PFN_vkVoidFunction;
+    static auto shim( u16 slot ) -> PFN_vkVoidFunction;
+
+public:
+    {handle_type:<14} {handle} = nullptr;
+    VkDispatchMode mode{handle_pad} = VkDispatchMode::Eager;
+
+    std::bitset<{prefix}FeatureNames.size()> enabledFeatures;
+
+    // Resolved entry points behind the profiling shims; only allocated in VkDispatchMode::Profile.
+    std::unique_ptr<PFN_vkVoidFunction[]> targets;
+{members}
+}};
+
+{layout}
+
+inline {cls}::{cls}( {getter_type} getProcAddr, {handle_type} {handle}, VkDispatchMode mode )
+    : {cls}( getProcAddr, {handle}, VkDispatchFeatures(), mode )
+{{
+}}
+
+inline {cls}::{cls}( {getter_type} getProcAddr, {handle_type} {handle}, VkDispatchFeatures const& features, VkDispatchMode mode )
+    : {handle}( {handle} ), mode( mode ), {first}( getProcAddr )
+{{
+    for ( usize feature = 0; feature < {prefix}FeatureNames.size(); feature += 1 ) {{
+        enabledFeatures[feature] = features.contains( {prefix}FeatureNames[feature] );
+    }}
+    VkDispatchRegistry<{cls}>::insert( VkDispatchKey( {handle} ), this );
+{bootstrap}
+    auto slots = this->slots();
+    if ( mode == VkDispatchMode::Profile ) {{
+        targets = std::make_unique<PFN_vkVoidFunction[]>( slots.size() );
+    }}
+    for ( u16 slot = 1; slot < slots.size(); slot += 1 ) {{
+        if ( stub( slot ) == nullptr ) {{
+            continue;
+        }}
+        auto available = false;
+        for ( auto index = slot; index != VkNoSlot && !available; index = {prefix}Commands[index].alias ) {{
+            available = enabled( index );
+        }}
+        if ( !available ) {{
+            continue;
+        }}
+        switch ( mode ) {{
+            case VkDispatchMode::Eager:
+                slots[slot] = resolve( slot );
+                break;
+            case VkDispatchMode::Lazy:
+                slots[slot] = stub( slot );
+                break;
+            case VkDispatchMode::Profile:
+                targets[slot] = resolve( slot );
+                slots[slot]   = targets[slot] != nullptr ? shim( slot ) : nullptr;
+                break;
+        }}
+    }}
+{epilogue}}}
+
+inline {cls}::~{cls}()
+{{
+    VkDispatchRegistry<{cls}>::erase( this );
+}}
+
+inline void {cls}::warm()
+{{
+    if ( mode != VkDispatchMode::Lazy ) {{
+        return;
+    }}
+    auto slots = this->slots();
+    for ( u16 slot = 1; slot < slots.size(); slot += 1 ) {{
+        if ( slots[slot] != nullptr && slots[slot] == stub( slot ) ) {{
+            slots[slot] = resolve( slot );
+        }}
+    }}
+}}
+
+inline auto {cls}::resolve( u16 slot ) const -> PFN_vkVoidFunction
+{{
+    for ( auto index = slot; index != VkNoSlot; index = {prefix}Commands[index].alias ) {{
+        if ( !enabled( index ) ) {{
+            continue;
+        }}
+        if ( auto function = resolve( {prefix}Commands[index].name.data() ) ) {{
+            return function;
+        }}
+    }}
+    return nullptr;
+}}
+'''
+
+
+def generate_dispatcher(registry, hot):
+    out = [PRELUDE.format(header_version=registry.header_version)]
+
+    context = [command for command in registry.commands.values() if command.level == 'Context' and command.groups]
+    context = [command for group in registry.groups for command in context if group is command.groups[0]]
+    context = [command for command in context if command.name != 'vkGetInstanceProcAddr']
+    initializers = []
+    members = []
+    for group in registry.groups:
+        commands = [command for command in context if command.groups[0] is group]
+        if not commands:
+            continue
+        initializers.append(f'        //=== {group.name} ===')
+        members.append('')
+        members.append(f'    //=== {group.name} ===')
+        width = max(len(f'PFN_{command.name}') for command in commands)
+        names = max(len(command.name) for command in commands)
+        for command in commands:
+            initializers.append(f'        , {command.name}(PFN_{command.name}(getProcAddr(nullptr, "{command.name}")))')
+            members.append(f'    {f"PFN_{command.name}":<{width}} {command.name:<{names}} = nullptr;')
+    out.append(CONTEXT.format(initializers='\n'.join(initializers), members='\n'.join(members)))
+
+    levels = (
+        ('Instance', 'VkInstanceDispatcher', 'VkInstance', 'instance', 'PFN_vkGetInstanceProcAddr', 'vkGetInstanceProcAddr'),
+        ('Device', 'VkDeviceDispatcher', 'VkDevice', 'device', 'PFN_vkGetDeviceProcAddr', 'vkGetDeviceProcAddr'),
+    )
+    for level, cls, handle_type, handle, getter_type, getter in levels:
+        if level == 'Instance':
+            registry.commands['vkGetInstanceProcAddr'].level = 'Instance'
+        sections, commands, features = registry.level(level, getter, hot)
+        if level == 'Instance':
+            registry.commands['vkGetInstanceProcAddr'].level = 'Context'
+
+        prefix = f'Vk{level}'
+        emit_tables(out, prefix, commands, features)
+        out.append('')
+
+        members = []
+        emit_members(members, sections)
+        if level == 'Instance':
+            # Device entry points are looked up through the instance before a device dispatcher exists.
+            members.append('')
+            members.append('    PFN_vkGetDeviceProcAddr vkGetDeviceProcAddr = nullptr;')
+            bootstrap = ''
+            epilogue = '\n    vkGetDeviceProcAddr = PFN_vkGetDeviceProcAddr( resolve( "vkGetDeviceProcAddr" ) );\n'
+        else:
+            bootstrap = '\n    vkGetDeviceProcAddr = PFN_vkGetDeviceProcAddr( vkGetDeviceProcAddr( device, "vkGetDeviceProcAddr" ) );\n'
+            epilogue = ''
+
+        layout = f'static_assert( offsetof( {cls}, {{}} ) == offsetof( {cls}, {commands[0].name} ) + ( {len(commands)} - 1 ) * sizeof( PFN_vkVoidFunction ) );'
+        if commands[-1].protect:
+            layout = '\n'.join((
+                f'#  if {commands[-1].protect}',
+                layout.format(commands[-1].name),
+                '#  else',
+                layout.format(f'{commands[-1].name}_placeholder'),
+                '#  endif',
+            ))
+        else:
+            layout = layout.format(commands[-1].name)
+        if sections[0][0] is HOT_GROUP:
+            last = sections[0][1][-1].name
+            layout += f'\nstatic_assert( offsetof( {cls}, {last} ) < offsetof( {cls}, {commands[0].name} ) + 2 * 64, "hot entry points must fit in two cache lines" );'
+        out.append(DISPATCHER.format(
+            cls=cls,
+            prefix=prefix,
+            handle_type=handle_type,
+            handle=handle,
+            handle_pad=' ' * (len(handle) - len('mode')),
+            getter_type=getter_type,
+            getter=getter,
+            count=len(commands),
+            first=commands[0].name,
+            layout=layout,
+            members='\n'.join(members),
+            bootstrap=bootstrap,
+            epilogue=epilogue,
+        ))
+        stubs = []
+        emit_stubs(stubs, cls, 'stub', 'VkLazyStub', commands)
+        stubs.append('')
+        emit_stubs(stubs, cls, 'shim', 'VkProfileShim', commands)
+        out.append('\n'.join(stubs))
+        out.append('')
+    return '\n'.join(out)
+
+
+def method_name(command):
+    name = command.name[2:]
+    if command.handle == 'VkCommandBuffer' and name.startswith('Cmd'):
+        name = name[3:]
+    return name
+
+
+def method_signature(command, params, name):
+    args = ', '.join(param.decl for param in params)
+    if command.return_type == 'void':
+        return f'VKAPI_ATTR void VKAPI_CALL {name}({args}) asm("_{command.name}");'
+    return f'VKAPI_ATTR auto VKAPI_CALL {name}({args}) -> {command.return_type} asm("_{command.name}");'
+
+
+def vkh_commands(registry):
+    """Commands in registry order, without the proc-addr getters that vkh.hpp declares as templates."""
+    commands = [command for group in registry.groups for command in registry.commands.values() if command.groups and command.groups[0] is group]
+    return [command for command in commands if command.name not in ('vkGetDeviceProcAddr', 'vkGetInstanceProcAddr')]
+
+
+def generate_vkh(registry):
+    out = [
+        '//',
+        '// Generated by scripts/vkgen.py from the Vulkan registry. Do not edit.',
+        '//',
+        '#pragma once',
+        '',
+        '#include <vulkan/vulkan.h>',
+        '',
+    ]
+    commands = vkh_commands(registry)
+    getters = {'VkDevice': 'vkGetDeviceProcAddr', 'VkInstance': 'vkGetInstanceProcAddr'}
+    for handle, variable in VKH_HANDLES:
+        out.append(f'struct {handle}_T {{')
+        out.append(f'    {handle}_T() = delete;')
+        out.append(f'    ~{handle}_T() = delete;')
+        out.append('')
+        if handle in getters:
+            out.append('    template<typename T = PFN_vkVoidFunction>')
+            out.append(f'    VKAPI_ATTR auto VKAPI_CALL {getters[handle][2:]}(this {handle}_T& {variable}, char const* pName) -> T asm("_{getters[handle]}");')
+            out.append('')
+        for protect, run in guard_runs([command for command in commands if command.handle == handle]):
+            if protect:
+                out.append(f'#  if {protect}')
+            for command in run:
+                params = command.params[1:]
+                this = f'this {handle}_T& {command.params[0].name}'
+                signature = method_signature(command, params, method_name(command))
+                out.append('    ' + signature.replace('(', f'({this}{", " if params else ""}', 1))
+            if protect:
+                out.append('#  endif')
+        out.append('};')
+    out.append('')
+    out.append('namespace vkh {')
+    for command in commands:
+        if command.level == 'Context' and command.name != 'vkGetInstanceProcAddr':
+            out.append('    ' + method_signature(command, command.params, method_name(command)))
+    out.append('}')
+    return '\n'.join(out) + '\n'
+
+
+def generate_trampolines(registry):
+    out = [
+        '//',
+        '// Generated by scripts/vkgen.py from the Vulkan registry. Do not edit.',
+        '//',
+        '// Definitions for the asm-labelled vkh.hpp methods. Each one finds the dispatcher that owns the',
+        '// handle through its dispatch key and tail-calls the slot, so no loader trampoline is involved. Slots',
+        '// are loaded atomically because a lazy stub on another thread may be patching them.',
+        '//',
+        '#include "dispatcher.hpp"',
+        '#include "vkh.hpp"',
+        '',
+        'template<typename Dispatcher, typename Handle>',
+        '[[gnu::always_inline]] static inline auto VkTrampolineDispatcher( Handle handle ) -> Dispatcher* {',
+        '    return VkDispatchRegistry<Dispatcher>::find( VkDispatchKey( handle ) );',
+        '}',
+        '',
+        'VKAPI_ATTR auto VKAPI_CALL VkTrampolineGetDeviceProcAddr(VkDevice device, char const* pName) -> PFN_vkVoidFunction asm("_vkGetDeviceProcAddr");',
+        'VKAPI_ATTR auto VKAPI_CALL VkTrampolineGetDeviceProcAddr(VkDevice device, char const* pName) -> PFN_vkVoidFunction {',
+        '    return VkTrampolineDispatcher<VkDeviceDispatcher>(device)->vkGetDeviceProcAddr(device, pName);',
+        '}',
+        '',
+        'VKAPI_ATTR auto VKAPI_CALL VkTrampolineGetInstanceProcAddr(VkInstance instance, char const* pName) -> PFN_vkVoidFunction asm("_vkGetInstanceProcAddr");',
+        'VKAPI_ATTR auto VKAPI_CALL VkTrampolineGetInstanceProcAddr(VkInstance instance, char const* pName) -> PFN_vkVoidFunction {',
+        '    return VkContextDispatcher::current.load(std::memory_order_acquire)->vkGetInstanceProcAddr(instance, pName);',
+        '}',
+    ]
+    commands = vkh_commands(registry)
+    dispatchers = {'VkInstance': 'VkInstanceDispatcher', 'VkPhysicalDevice': 'VkInstanceDispatcher'}
+    for handle, _ in VKH_HANDLES:
+        for protect, run in guard_runs([command for command in commands if command.handle == handle]):
+            out.append('')
+            if protect:
+                out.append(f'#if {protect}')
+            for command in run:
+                this = command.params[0].name
+                params = command.params[1:]
+                signature = method_signature(command, params, f'{handle}_T::{method_name(command)}').split(' asm(')[0]
+                signature = signature.replace('(', f'(this {handle}_T& {this}{", " if params else ""}', 1)
+                arguments = ', '.join([f'&{this}'] + [param.name for param in params])
+                dispatcher = dispatchers.get(handle, 'VkDeviceDispatcher')
+                out.append(f'{signature} {{')
+                out.append(f'    return std::atomic_ref(VkTrampolineDispatcher<{dispatcher}>(&{this})->{command.name}).load(std::memory_order_relaxed)({arguments});')
+                out.append('}')
+            if protect:
+                out.append('#endif')
+    out.append('')
+    for command in commands:
+        if command.level == 'Context' and command.name != 'vkGetInstanceProcAddr':
+            signature = method_signature(command, command.params, f'vkh::{method_name(command)}').split(' asm(')[0]
+            arguments = ', '.join(param.name for param in command.params)
+            out.append(f'{signature} {{')
+            out.append(f'    return VkContextDispatcher::current.load(std::memory_order_acquire)->{command.name}({arguments});')
+            out.append('}')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--registry', required=True, type=pathlib.Path)
+    parser.add_argument('--output', required=True, type=pathlib.Path)
+    parser.add_argument('--hot', type=pathlib.Path, help='entry points to pack into the first cache lines of a dispatcher')
+    arguments = parser.parse_args()
+
+    registry = Registry(arguments.registry)
+    arguments.output.mkdir(parents=True, exist_ok=True)
+    hot = []
+    if arguments.hot is not None:
+        for line in arguments.hot.read_text().splitlines():
+            if line.strip() and not line.startswith('#'):
+                hot.append(line.strip())
+    (arguments.output / 'dispatcher.hpp').write_text(generate_dispatcher(registry, hot))
+    (arguments.output / 'vkh.hpp').write_text(generate_vkh(registry))
+    (arguments.output / 'vkh.cpp').write_text(generate_trampolines(registry))
+
+
+if __name__ == '__main__':
+    main()
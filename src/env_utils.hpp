@@ -0,0 +1,10 @@
+#pragma once
+
+#include "pch.hpp"
+
+static auto env_read_string(char const* name) -> std::optional<std::string_view> {
+    if (auto value = std::getenv(name); value != nullptr) {
+        return std::string_view(value);
+    }
+    return std::nullopt;
+}
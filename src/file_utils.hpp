@@ -10,4 +10,26 @@ static auto file_read_bytes(std::string const& path) -> std::optional<std::vecto
         return std::vector(std::istreambuf_iterator(stream), {});
     }
     return std::nullopt;
-}
\ No newline at end of file
+}
+
+// Writes to a temporary file next to path and renames it over path, so readers see either the old or the new file.
+static auto file_write_bytes_atomic(std::string const& path, std::span<char const> bytes) -> bool {
+    auto temporary = std::format("{}.{:08x}.tmp", path, std::random_device()());
+    auto stream = std::ofstream(temporary, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open()) {
+        return false;
+    }
+    stream.write(bytes.data(), std::streamsize(bytes.size()));
+    stream.close();
+    auto error = std::error_code();
+    if (!stream) {
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "pch.hpp"
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+// Reports the names of files written or moved into one directory, through inotify. Start() fails on other
+// platforms, so callers simply go without watching there.
+struct FileWatcher {
+    i32 Descriptor = -1;
+
+    auto Start(this FileWatcher& Self, std::string const& Directory) -> bool {
+#if defined(__linux__)
+        Self.Descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (Self.Descriptor == -1) {
+            return false;
+        }
+        // Editors and compilers that write a temporary file and rename it show up as IN_MOVED_TO.
+        if (inotify_add_watch(Self.Descriptor, Directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) == -1) {
+            close(Self.Descriptor);
+            Self.Descriptor = -1;
+            return false;
+        }
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void Stop(this FileWatcher& Self) {
+#if defined(__linux__)
+        if (Self.Descriptor != -1) {
+            close(Self.Descriptor);
+            Self.Descriptor = -1;
+        }
+#endif
+    }
+
+    // Waits up to TimeoutMilliseconds for changes and appends the names of the changed files to Names, once per event.
+    void Wait(this FileWatcher& Self, i32 TimeoutMilliseconds, std::vector<std::string>& Names) {
+#if defined(__linux__)
+        auto Poll = pollfd{
+            .fd = Self.Descriptor,
+            .events = POLLIN,
+            .revents = 0
+        };
+        if (poll(&Poll, 1, TimeoutMilliseconds) <= 0) {
+            return;
+        }
+        alignas(inotify_event) char Buffer[4096];
+        while (true) {
+            auto Size = read(Self.Descriptor, Buffer, sizeof(Buffer));
+            if (Size <= 0) {
+                return;
+            }
+            for (isize Offset = 0; Offset < Size;) {
+                auto Event = reinterpret_cast<inotify_event const*>(Buffer + Offset);
+                if (Event->len != 0) {
+                    Names.emplace_back(Event->name);
+                }
+                Offset += isize(sizeof(inotify_event) + Event->len);
+            }
+        }
+#endif
+    }
+};
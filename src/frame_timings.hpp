@@ -0,0 +1,137 @@
+#pragma once
+
+#include "frame_trace.hpp"
+
+enum class FramePhase : u32 {
+    Events,
+    Wait,
+    Acquire,
+    Record,
+    Descriptors,
+    Submit,
+    Present,
+};
+
+static constexpr char const* FRAME_PHASE_NAMES[] = {
+    "events",
+    "wait",
+    "acquire",
+    "record",
+    "descriptors",
+    "submit",
+    "present",
+};
+
+// Power of two, so the ring index is a mask.
+static constexpr u32 FRAME_TIMING_CAPACITY = 1024;
+
+struct FrameTimingSample {
+    f32 PhaseMilliseconds[std::size(FRAME_PHASE_NAMES)];
+    f32 FrameMilliseconds;
+};
+
+struct FrameTimingPercentiles {
+    f64 P50;
+    f64 P95;
+    f64 P99;
+};
+
+// CPU time of each loop phase over the last FRAME_TIMING_CAPACITY frames. Mark() charges the time since the previous
+// mark to a phase, so a phase may be marked several times per frame. Marks outside BeginFrame/EndFrame are ignored,
+// which keeps commands recorded ahead of the loop out of the statistics, and so are marks from threads other than
+// the one that began the frame. With a Trace attached, every mark is also added to it as a CPU event.
+struct FrameTimings {
+    FrameTimingSample Samples[FRAME_TIMING_CAPACITY];
+    FrameTimingSample Current;
+    u64 FrameCount = 0;
+    bool Active = false;
+    std::thread::id Owner;
+    FrameTrace* Trace = nullptr;
+    std::chrono::steady_clock::time_point FrameStart;
+    std::chrono::steady_clock::time_point PhaseStart;
+
+    void BeginFrame(this FrameTimings& Self) {
+        Self.Current = {};
+        Self.Active = true;
+        Self.Owner = std::this_thread::get_id();
+        Self.FrameStart = std::chrono::steady_clock::now();
+        Self.PhaseStart = Self.FrameStart;
+    }
+
+    void Mark(this FrameTimings& Self, FramePhase Phase) {
+        if (!Self.Active || std::this_thread::get_id() != Self.Owner) {
+            return;
+        }
+        auto Now = std::chrono::steady_clock::now();
+        Self.Current.PhaseMilliseconds[std::to_underlying(Phase)] += std::chrono::duration<f32, std::milli>(Now - Self.PhaseStart).count();
+        if (Self.Trace != nullptr) {
+            Self.Trace->Add(
+                FRAME_PHASE_NAMES[std::to_underlying(Phase)],
+                TraceTrack::Cpu,
+                Self.FrameCount,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Self.PhaseStart.time_since_epoch()).count(),
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Now.time_since_epoch()).count()
+            );
+        }
+        Self.PhaseStart = Now;
+    }
+
+    void EndFrame(this FrameTimings& Self) {
+        Self.Current.FrameMilliseconds = std::chrono::duration<f32, std::milli>(std::chrono::steady_clock::now() - Self.FrameStart).count();
+        Self.Samples[Self.FrameCount & (FRAME_TIMING_CAPACITY - 1)] = Self.Current;
+        Self.FrameCount += 1;
+        Self.Active = false;
+    }
+
+    auto SampleCount(this FrameTimings const& Self) -> u32 {
+        return u32(std::min(Self.FrameCount, u64(FRAME_TIMING_CAPACITY)));
+    }
+
+    // Phase is an index into FRAME_PHASE_NAMES, or std::size(FRAME_PHASE_NAMES) for the whole frame.
+    auto Percentiles(this FrameTimings const& Self, usize Phase) -> FrameTimingPercentiles {
+        auto Values = std::vector<f32>(Self.SampleCount());
+        for (u32 i = 0; i < Values.size(); i += 1) {
+            Values[i] = Phase < std::size(FRAME_PHASE_NAMES) ? Self.Samples[i].PhaseMilliseconds[Phase] : Self.Samples[i].FrameMilliseconds;
+        }
+        if (Values.empty()) {
+            return {};
+        }
+        auto Rank = [&](f64 Fraction) -> f64 {
+            auto Nth = Values.begin() + isize(std::min(usize(Fraction * f64(Values.size())), Values.size() - 1));
+            std::ranges::nth_element(Values, Nth);
+            return *Nth;
+        };
+        return FrameTimingPercentiles{
+            .P50 = Rank(0.50),
+            .P95 = Rank(0.95),
+            .P99 = Rank(0.99),
+        };
+    }
+
+    auto ToJson(this FrameTimings const& Self) -> std::string {
+        auto Json = std::string();
+        auto AppendPercentiles = [&](FrameTimingPercentiles const& Percentiles) {
+            std::format_to(std::back_inserter(Json), "{{\"p50\":{:.4f},\"p95\":{:.4f},\"p99\":{:.4f}}}", Percentiles.P50, Percentiles.P95, Percentiles.P99);
+        };
+        std::format_to(std::back_inserter(Json), "{{\"frames\":{},\"window\":{},\"unit\":\"ms\",\"frame\":", Self.FrameCount, Self.SampleCount());
+        AppendPercentiles(Self.Percentiles(std::size(FRAME_PHASE_NAMES)));
+        Json += ",\"phases\":{";
+        for (usize i = 0; i < std::size(FRAME_PHASE_NAMES); i += 1) {
+            std::format_to(std::back_inserter(Json), "{}\"{}\":", i != 0 ? "," : "", FRAME_PHASE_NAMES[i]);
+            AppendPercentiles(Self.Percentiles(i));
+        }
+        Json += "}}";
+        return Json;
+    }
+
+    void PrintSummary(this FrameTimings const& Self, FILE* Stream) {
+        auto Frame = Self.Percentiles(std::size(FRAME_PHASE_NAMES));
+        std::println(Stream, "[info]: frame timings over the last {} of {} frames (ms):", Self.SampleCount(), Self.FrameCount);
+        std::println(Stream, "[info]:   {:<12} {:>9} {:>9} {:>9}", "phase", "p50", "p95", "p99");
+        for (usize i = 0; i < std::size(FRAME_PHASE_NAMES); i += 1) {
+            auto Phase = Self.Percentiles(i);
+            std::println(Stream, "[info]:   {:<12} {:>9.3f} {:>9.3f} {:>9.3f}", FRAME_PHASE_NAMES[i], Phase.P50, Phase.P95, Phase.P99);
+        }
+        std::println(Stream, "[info]:   {:<12} {:>9.3f} {:>9.3f} {:>9.3f}", "frame", Frame.P50, Frame.P95, Frame.P99);
+    }
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "pch.hpp"
+
+enum class TraceTrack : u32 {
+    Cpu = 1,
+    Gpu = 2,
+    GpuCompute = 3,
+};
+
+static constexpr char const* TRACE_TRACK_NAMES[] = {
+    "",
+    "cpu",
+    "gpu",
+    "gpu compute",
+};
+
+struct TraceEvent {
+    char const* Name;
+    TraceTrack Track;
+    u64 Frame;
+    i64 BeginNanoseconds;
+    i64 EndNanoseconds;
+};
+
+// Complete events of the first FrameLimit frames, written as a Chrome trace that chrome://tracing and Perfetto load.
+// Timestamps are nanoseconds of std::chrono::steady_clock, which GPU timestamps are calibrated against.
+struct FrameTrace {
+    std::vector<TraceEvent> Events;
+    u64 FrameLimit = 0;
+
+    static auto Now() -> i64 {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void Add(this FrameTrace& Self, char const* Name, TraceTrack Track, u64 Frame, i64 BeginNanoseconds, i64 EndNanoseconds) {
+        if (Frame < Self.FrameLimit) {
+            Self.Events.push_back(TraceEvent{
+                .Name = Name,
+                .Track = Track,
+                .Frame = Frame,
+                .BeginNanoseconds = BeginNanoseconds,
+                .EndNanoseconds = EndNanoseconds
+            });
+        }
+    }
+
+    auto Write(this FrameTrace const& Self, std::string const& Path) -> bool {
+        auto Stream = std::ofstream(Path);
+        if (!Stream.is_open()) {
+            return false;
+        }
+        auto Origin = Self.Events.empty() ? 0 : std::ranges::min(Self.Events, {}, &TraceEvent::BeginNanoseconds).BeginNanoseconds;
+        Stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        for (u32 Track = 1; Track < std::size(TRACE_TRACK_NAMES); Track += 1) {
+            std::println(Stream, "{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}},", Track, TRACE_TRACK_NAMES[Track]);
+        }
+        for (usize i = 0; i < Self.Events.size(); i += 1) {
+            auto const& Event = Self.Events[i];
+            std::print(Stream, "{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f},\"args\":{{\"frame\":{}}}}}{}\n",
+                Event.Name,
+                std::to_underlying(Event.Track),
+                f64(Event.BeginNanoseconds - Origin) / 1000.0,
+                f64(Event.EndNanoseconds - Event.BeginNanoseconds) / 1000.0,
+                Event.Frame,
+                i + 1 != Self.Events.size() ? "," : ""
+            );
+        }
+        Stream << "]}\n";
+        return true;
+    }
+};
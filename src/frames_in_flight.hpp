@@ -0,0 +1,59 @@
+#pragma once
+
+#include "pch.hpp"
+
+// The adaptive depth looks at the share of the frame spent waiting on the timeline over each window: below the
+// lower bound the GPU keeps up and a frame is dropped from the queue, above the upper bound one is added. The window
+// after a change is not judged, since frames queued at the old depth are still draining.
+static constexpr u32 ADAPTIVE_FRAMES_IN_FLIGHT_WINDOW = 60;
+static constexpr f64 ADAPTIVE_FRAMES_IN_FLIGHT_LOWER_WAIT = 0.05;
+static constexpr f64 ADAPTIVE_FRAMES_IN_FLIGHT_RAISE_WAIT = 0.25;
+static constexpr u32 ADAPTIVE_FRAMES_IN_FLIGHT_SETTLE_WINDOWS = 1;
+// After a raise the depth is not lowered for a number of windows, starting at the first bound and doubling up to the
+// second every time a lower had to be undone.
+static constexpr u32 ADAPTIVE_FRAMES_IN_FLIGHT_LOWER_HOLD_WINDOWS = 4;
+static constexpr u32 ADAPTIVE_FRAMES_IN_FLIGHT_MAX_LOWER_HOLD_WINDOWS = 128;
+
+// Moves the depth between 1 and MaxDepth. The wait share depends on the depth it steers: when the GPU takes between
+// about a third and all of the CPU frame time, one frame in flight serializes the two and waits a lot, while two
+// overlap them and wait for nothing. Going by the thresholds alone the depth would flip every window, so a raise
+// right after a lower doubles how long the depth then stays put, and a lower that sticks resets it.
+struct FramesInFlightController {
+    u32 MaxDepth = 1;
+    u32 Depth = 1;
+    u32 SettleWindows = 0;
+    u32 LowerHoldWindows = 0;
+    u32 LowerBackoffWindows = ADAPTIVE_FRAMES_IN_FLIGHT_LOWER_HOLD_WINDOWS;
+    bool LastChangeLowered = false;
+
+    // Called with the wait share of each window; returns whether the depth changed.
+    auto Update(this FramesInFlightController& Self, f64 WaitShare) -> bool {
+        if (Self.SettleWindows != 0) {
+            Self.SettleWindows -= 1;
+            return false;
+        }
+        if (Self.LowerHoldWindows != 0) {
+            Self.LowerHoldWindows -= 1;
+        }
+        if (WaitShare > ADAPTIVE_FRAMES_IN_FLIGHT_RAISE_WAIT && Self.Depth < Self.MaxDepth) {
+            if (Self.LastChangeLowered) {
+                Self.LowerBackoffWindows = std::min(Self.LowerBackoffWindows * 2, ADAPTIVE_FRAMES_IN_FLIGHT_MAX_LOWER_HOLD_WINDOWS);
+            }
+            Self.Depth += 1;
+            Self.LastChangeLowered = false;
+            Self.SettleWindows = ADAPTIVE_FRAMES_IN_FLIGHT_SETTLE_WINDOWS;
+            Self.LowerHoldWindows = Self.LowerBackoffWindows;
+            return true;
+        }
+        if (WaitShare < ADAPTIVE_FRAMES_IN_FLIGHT_LOWER_WAIT && Self.Depth > 1 && Self.LowerHoldWindows == 0) {
+            if (Self.LastChangeLowered) {
+                Self.LowerBackoffWindows = ADAPTIVE_FRAMES_IN_FLIGHT_LOWER_HOLD_WINDOWS;
+            }
+            Self.Depth -= 1;
+            Self.LastChangeLowered = true;
+            Self.SettleWindows = ADAPTIVE_FRAMES_IN_FLIGHT_SETTLE_WINDOWS;
+            return true;
+        }
+        return false;
+    }
+};
@@ -1,15 +1,167 @@
 #include "dispatcher.hpp"
+#include "vkh.hpp"
 #include "file_utils.hpp"
+#include "env_utils.hpp"
+#include "perf_utils.hpp"
+#include "library_utils.hpp"
+#include "frame_timings.hpp"
+#include "frame_trace.hpp"
+#include "worker_pool.hpp"
+#include "spsc_queue.hpp"
+#include "tile_damage.hpp"
+#include "render_scale.hpp"
+#include "frames_in_flight.hpp"
+#include "file_watcher.hpp"
 
 #include "SDL_video.h"
 #include "SDL_vulkan.h"
 #include "SDL_events.h"
 
-static constexpr u32 MAX_FRAMES_IN_FLIGHT = 3;
+// KOMPUTE_FRAMES_IN_FLIGHT sizes the per-frame-slot objects at startup, up to MAX_FRAMES_IN_FLIGHT.
+static constexpr u32 MAX_FRAMES_IN_FLIGHT = 8;
+static constexpr u32 DEFAULT_FRAMES_IN_FLIGHT = 3;
+// Damage beyond this many rectangles is redrawn as their bounding rectangle.
+static constexpr u32 DAMAGE_MAX_RECTS = 64;
+static constexpr u32 VULKAN_API_VERSION = VK_API_VERSION_1_2;
+static constexpr u32 DISPATCH_BENCHMARK_ITERATIONS = 10'000'000;
+static constexpr VkExtent2D HEADLESS_DEFAULT_EXTENT = {1280, 720};
+static constexpr u32 HEADLESS_DEFAULT_FRAMES = 1000;
+static constexpr u32 GPU_TRACE_DEFAULT_FRAMES = 600;
+static constexpr char const* PIPELINE_CACHE_DEFAULT_PATH = "kompute.pipelinecache";
+static constexpr u32 PIPELINE_CACHE_FILE_MAGIC = 0x4843504B;
+static constexpr char const* SHADER_DIRECTORY = "../shaders";
+static constexpr char const* COMPUTE_SHADER_SOURCE = "../shaders/ps.comp";
+static constexpr char const* COMPUTE_SHADER_BINARY = "../shaders/ps.comp.spv";
+// Built from the same source with the image format declared, for devices without shaderStorageImageWriteWithoutFormat.
+static constexpr char const* COMPUTE_SHADER_FORMATTED_BINARY = "../shaders/ps.comp.rgba8.spv";
+static constexpr char const* COMPUTE_SHADER_FORMAT_DEFINE = "-DSTORAGE_IMAGE_FORMAT=rgba8";
+// The glslc the build compiles shaders with, passed in by CMake.
+#if defined(KOMPUTE_GLSLC)
+static constexpr char const* GLSLC_EXECUTABLE = KOMPUTE_GLSLC;
+#else
+static constexpr char const* GLSLC_EXECUTABLE = "glslc";
+#endif
+static constexpr i32 SHADER_WATCH_TIMEOUT_MILLISECONDS = 100;
+// Workgroup sizes the autotuner times, as {x, y}; sizes beyond the device limits are left out. 8x8 stays within the
+// limits every device guarantees and stands in when the default does not fit.
+static constexpr VkExtent2D WORKGROUP_SIZE_CANDIDATES[] = {{8, 8}, {16, 16}, {32, 8}, {64, 4}, {32, 32}};
+static constexpr VkExtent2D DEFAULT_WORKGROUP_SIZE = {32, 32};
+static constexpr VkExtent2D FALLBACK_WORKGROUP_SIZE = {8, 8};
+// Each candidate renders this many frames, the first WARMUP ones untimed; the median dispatch time per pixel of the
+// rest counts.
+static constexpr u32 WORKGROUP_TUNING_WARMUP_FRAMES = 8;
+static constexpr u32 WORKGROUP_TUNING_SAMPLE_FRAMES = 32;
+static constexpr char const* WORKGROUP_TUNING_PATH = "kompute.workgroups";
+
+// Prefix of the pipeline cache file. The Vulkan cache header that follows it identifies the device, but not the
+// driver version, which invalidates caches just as well.
+struct PipelineCacheFileHeader {
+    u32 Magic;
+    u32 DriverVersion;
+    u64 DataSize;
+};
+
+#if defined(_WIN32)
+static constexpr char const* VULKAN_LIBRARY_NAME = "vulkan-1.dll";
+#elif defined(__APPLE__)
+static constexpr char const* VULKAN_LIBRARY_NAME = "libvulkan.1.dylib";
+#else
+static constexpr char const* VULKAN_LIBRARY_NAME = "libvulkan.so.1";
+#endif
+static constexpr std::string_view DISPATCH_MODE_NAMES[] = {"eager", "lazy", "profile"};
+
+// How the compute storage image reaches the shader.
+enum class DescriptorStrategy {
+    // One descriptor set per resource, written once.
+    Persistent,
+    // VK_KHR_push_descriptor: the descriptor is pushed while recording.
+    Push,
+    // VK_EXT_descriptor_buffer: the descriptor is written once into a buffer that is bound while recording.
+    Buffer,
+};
+static constexpr std::string_view DESCRIPTOR_STRATEGY_NAMES[] = {"persistent", "push", "buffer"};
+
+// GPU timestamp scopes of a frame, each with a begin and an end query per frame slot.
+enum class GpuScope : u32 {
+    ComputeBarrier,
+    Dispatch,
+    BlitBarriers,
+    Blit,
+    PresentBarrier,
+};
+static constexpr char const* GPU_SCOPE_NAMES[] = {"compute barrier", "dispatch", "blit barriers", "blit", "present barrier"};
+static constexpr u32 GPU_SCOPE_QUERY_COUNT = 2 * std::size(GPU_SCOPE_NAMES);
+
+// Parts of a frame that record into their own secondary command buffer, in the order the primary executes them.
+static constexpr char const* RECORD_PASS_NAMES[] = {"compute", "present"};
+static constexpr u32 RECORD_PASS_COUNT = std::size(RECORD_PASS_NAMES);
+
+// What the event pump on the main thread forwards to the render thread.
+enum class WindowEventType {
+    Quit,
+    // Width and Height hold the new drawable size.
+    Resize,
+    KeyDown,
+    // The window needs its contents drawn again.
+    Expose,
+    // A reloaded compute pipeline is waiting to be swapped in.
+    PipelineReady,
+};
+
+struct WindowEvent {
+    WindowEventType Type;
+    i32 Width;
+    i32 Height;
+    SDL_Keycode Key;
+    std::chrono::steady_clock::time_point Time;
+};
+
+static constexpr u32 WINDOW_EVENT_QUEUE_CAPACITY = 256;
+static constexpr i32 EVENT_PUMP_TIMEOUT_MILLISECONDS = 10;
+// On demand the pump only has to notice the render thread finishing after a quit it forwarded itself.
+static constexpr i32 ON_DEMAND_EVENT_PUMP_TIMEOUT_MILLISECONDS = 250;
+
+// Indexed by VkPresentModeKHR.
+static constexpr std::string_view PRESENT_MODE_NAMES[] = {"immediate", "mailbox", "fifo", "fifo_relaxed"};
+
+// A compute pipeline replaced by a shader reload, destroyed once the timeline semaphore reaches RetireValue.
+struct RetiredPipeline {
+    VkPipeline Pipeline;
+    u64 RetireValue;
+};
+
+// Size-dependent objects replaced by a swapchain recreation. Frames submitted before the recreation may still
+// use them, so they are destroyed only once the timeline semaphore reaches RetireValue.
+struct RetiredTextureSet {
+    u64 RetireValue;
+    VkSwapchainKHR Swapchain;
+    u32 SurfaceImageCount;
+    VkImage* SurfaceImages;
+    VkImageView* SurfaceImageViews;
+    u32 ComputeImageCount;
+    VkImage* ComputeImages;
+    VkImageView* ComputeImageViews;
+    VkDeviceMemory ComputeImageMemory;
+    VkDescriptorPool ComputeDescriptorPool;
+    VkDescriptorSet* ComputeDescriptorSets;
+    VkBuffer ComputeDescriptorBuffer;
+    VkDeviceMemory ComputeDescriptorBufferMemory;
+    VkCommandPool* RecordedCommandPools;
+    VkCommandBuffer* RecordedCommandBuffers;
+};
 
 struct VulkanApplication {
     SDL_Window* WindowPlatform;
+    VkExtent2D DrawableExtent;
+    SpscQueue<WindowEvent, WINDOW_EVENT_QUEUE_CAPACITY> WindowEvents;
+    std::atomic<bool> RenderFinished;
+    bool OnDemandRendering;
+    bool Headless;
+    VkExtent2D HeadlessExtent;
+    u32 HeadlessFrameLimit;
+    void* VulkanLibrary;
 
+    VkDispatchMode DispatchMode;
     VkDeviceDispatcher* DeviceDispatcher;
     VkContextDispatcher* ContextDispatcher;
     VkInstanceDispatcher* InstanceDispatcher;
@@ -18,132 +170,348 @@ struct VulkanApplication {
     VkLayerProperties* InstanceLayerProperties;
 
     VkInstance Instance;
+    bool DebugUtilsEnabled;
     VkDebugUtilsMessengerEXT DebugUtilsMessengerEXT;
     u32 PhysicalDeviceCount;
     VkPhysicalDevice* PhysicalDevices;
     VkPhysicalDevice PhysicalDevice;
+    VkPhysicalDeviceProperties PhysicalDeviceProperties;
+    VkPhysicalDeviceIDProperties PhysicalDeviceIdProperties;
     VkDevice LogicalDevice;
     VkSurfaceCapabilitiesKHR SurfaceCapabilities;
 
     VkSurfaceKHR Surface;
+    VkFormat SurfaceFormat;
+    VkPresentModeKHR PresentMode;
+    u32 SurfaceMinImageCount;
+    bool PresentWaitEnabled;
+    bool LowLatencyPacing;
     VkSwapchainKHR Swapchain;
     u32 SurfaceImageIndex;
     u32 SurfaceImageCount;
     VkImage* SurfaceImages;
     VkImageView* SurfaceImageViews;
+    VkDeviceMemory SurfaceImageMemory;
 
-    VkImage ComputeImage;
-    VkImageView ComputeImageView;
+    bool StorageWriteWithoutFormat;
+    char const* ComputeShaderBinary;
+    bool DirectSwapchainOutput;
+    bool AliasComputeImages;
+    u32 ComputeImageCount;
+    VkImage* ComputeImages;
+    VkImageView* ComputeImageViews;
     VkDeviceMemory ComputeImageMemory;
+    std::vector<RetiredTextureSet> RetiredTextureSets;
 
     VkQueue Queue;
     u32 QueueIndex;
     u32 QueueFamilyIndex;
+    bool AsyncCompute;
+    VkQueue ComputeQueue;
+    u32 ComputeQueueFamilyIndex;
 
     VkFence* Fences;
     VkSemaphore* SubmitSemaphores;
     VkSemaphore* AcquireSemaphores;
     VkCommandPool* CommandPools;
     VkCommandBuffer* CommandBuffers;
-    VkDescriptorPool* DescriptorPools;
     VkSemaphore TimelineSemaphore;
+    VkCommandPool* ComputeCommandPools;
+    VkCommandBuffer* ComputeCommandBuffers;
+    VkSemaphore ComputeTimelineSemaphore;
+    std::vector<VkSemaphoreSubmitInfo> SubmitWaitSemaphores;
+
+    bool PrerecordCommands;
+    VkPipeline RecordedPipelines[MAX_FRAMES_IN_FLIGHT];
+    VkCommandPool* RecordedCommandPools;
+    VkCommandBuffer* RecordedCommandBuffers;
+
+    bool RecordSecondaryCommands;
+    WorkerPool RecordWorkers;
+    VkCommandPool* RecordCommandPools;
+    VkCommandBuffer* RecordSecondaryCommandBuffers;
+
+    DescriptorStrategy ComputeDescriptorStrategy;
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT DescriptorBufferProperties;
+    u32 ComputeDescriptorCount;
+    VkDescriptorPool ComputeDescriptorPool;
+    VkDescriptorSet* ComputeDescriptorSets;
+    VkBuffer ComputeDescriptorBuffer;
+    VkDeviceMemory ComputeDescriptorBufferMemory;
+    VkDeviceAddress ComputeDescriptorBufferAddress;
+    VkDeviceSize ComputeDescriptorBufferStride;
+
+    std::string PipelineCachePath;
+    VkPipelineCache PipelineCache;
 
     VkPipeline ComputePipeline;
+    VkExtent2D WorkgroupSize;
+    bool WorkgroupTuning;
+    bool WorkgroupTuningProfiler;
+    std::string WorkgroupTuningKey;
+    std::vector<VkExtent2D> WorkgroupCandidates;
+    std::vector<VkPipeline> WorkgroupCandidatePipelines;
+    std::vector<std::vector<f64>> WorkgroupCandidateSamples;
+    u32 WorkgroupTuningFrame;
+    u32 WorkgroupSlotCandidates[MAX_FRAMES_IN_FLIGHT];
+    bool ShaderHotReload;
+    FileWatcher ShaderWatcher;
+    std::thread ShaderReloadThread;
+    std::atomic<bool> ShaderReloadStopping;
+    std::atomic<VkPipeline> PendingComputePipeline;
+    u32 PipelineReadyEvent;
+    std::vector<RetiredPipeline> RetiredPipelines;
     VkPipelineLayout ComputePipelineLayout;
     VkDescriptorSetLayout ComputeDescriptorSetLayout;
 
+    u32 FrameSlotCount;
+    u32 FramesInFlight;
+    bool AdaptiveFramesInFlight;
+    FramesInFlightController AdaptiveDepth;
+    u32 AdaptiveWindowFrames;
+    std::chrono::steady_clock::duration AdaptiveWaitTime;
+    std::chrono::steady_clock::time_point AdaptiveWindowStart;
+
+    bool DynamicResolution;
+    RenderScaleController RenderScale;
+    VkExtent2D RenderExtent;
+
+    bool IncrementalDamage;
+    bool IncrementalPresentEnabled;
+    TileDamage Damage;
+    std::vector<u64> ComputeImageVersions;
+    std::vector<u64> SurfaceImageVersions;
+    u64 PresentedVersion;
+    u64 DispatchSinceVersion;
+    u64 SurfaceSinceVersion;
+    std::vector<TileRect> DispatchRects;
+    std::vector<TileRect> SurfaceRects;
+    std::vector<TileRect> PresentRects;
+    std::vector<VkImageBlit2> BlitRegions;
+    std::vector<VkRectLayerKHR> PresentRectangles;
+
+    FrameTimings Timings;
+
+    FrameTrace Trace;
+    bool TimestampsSupported;
+    bool GpuProfilerEnabled;
+    bool CalibratedTimestampsEnabled;
+    bool TimestampCalibrated;
+    f64 TimestampPeriod;
+    u64 TimestampCalibrationTicks;
+    i64 TimestampCalibrationNanoseconds;
+    VkQueryPool TimestampQueryPool;
+    u64 TimestampQueryFrames[MAX_FRAMES_IN_FLIGHT];
+    bool TimestampQueryDispatched[MAX_FRAMES_IN_FLIGHT];
+    u64 TimestampQueryPixels[MAX_FRAMES_IN_FLIGHT];
+    i64 TimestampQuerySubmitTimes[MAX_FRAMES_IN_FLIGHT];
+    f64 GpuScopeMilliseconds[std::size(GPU_SCOPE_NAMES)];
+    u64 GpuScopeSamples[std::size(GPU_SCOPE_NAMES)];
+
     VulkanApplication() {
         this->CreateWindowPlatform();
         this->CreateVulkanInstance();
+        this->SelectDynamicResolution();
         this->CreateLogicalDevice();
+        this->SelectFramesInFlight();
+        if (env_read_string("KOMPUTE_DISPATCH_BENCHMARK")) {
+            this->BenchmarkDispatch();
+        }
         this->CreateDeviceObjects();
+        this->SelectShaderHotReload();
+        this->SelectWorkgroupSize();
+        this->CreateGpuProfiler();
+        this->CreatePipelineCache();
         this->CreateVulkanShaders();
-        this->CreateVulkanTextures();
+        this->UpdateSurfaceCapabilities();
+        this->SelectPresentMode();
+        this->SelectOutputPath();
+        this->CreateVulkanTextures(VK_NULL_HANDLE);
+        this->CreateComputeDescriptors();
+        this->PrerecordCommands = env_read_string("KOMPUTE_PRERECORD_COMMANDS").has_value() && !this->AsyncCompute && !this->DynamicResolution;
+        this->SelectDamageTracking();
+        this->UpdateRenderExtent();
+        this->CreateRecordedCommands();
+        // The worker, render and shader reload threads call through the dispatchers from here on.
+        this->InstanceDispatcher->warm();
+        this->DeviceDispatcher->warm();
+        this->CreateRecordWorkers();
+        this->CreateShaderReloader();
     }
 
     ~VulkanApplication() {
+        this->DeleteShaderReloader();
+        this->DeleteRetiredPipelines(std::numeric_limits<u64>::max());
+        this->DeleteRetiredTextures(std::numeric_limits<u64>::max());
+        this->DeleteRecordWorkers();
+        this->DeleteRecordedCommands();
+        this->DeleteComputeDescriptors();
         this->DeleteVulkanTextures();
         this->DeleteVulkanShaders();
+        this->DeletePipelineCache();
+        this->DeleteGpuProfiler();
         this->DeleteDeviceObjects();
         this->DeleteLogicalDevice();
         this->DeleteVulkanInstance();
         this->DeleteWindowPlatform();
     }
 
+    // KOMPUTE_HEADLESS=WIDTHxHEIGHT runs without SDL or a surface: frames render into offscreen images as fast as the
+    // device allows, for KOMPUTE_HEADLESS_FRAMES frames. Works on render nodes and software drivers such as lavapipe.
+    // KOMPUTE_ON_DEMAND renders a window frame only when something that affects the image changed and otherwise
+    // sleeps until the next event, instead of redrawing identical frames at full rate.
     void CreateWindowPlatform(this VulkanApplication& Self) {
-        Self.WindowPlatform = SDL_CreateWindow("Kompute", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 800, 600, SDL_WINDOW_ALLOW_HIGHDPI | SDL_WINDOW_VULKAN);
+        Self.Headless = false;
+        Self.OnDemandRendering = false;
+        Self.SurfaceFormat = VK_FORMAT_B8G8R8A8_UNORM;
+        if (auto HeadlessString = env_read_string("KOMPUTE_HEADLESS")) {
+            Self.Headless = true;
+            Self.HeadlessExtent = HEADLESS_DEFAULT_EXTENT;
+            Self.HeadlessFrameLimit = HEADLESS_DEFAULT_FRAMES;
+            Self.SurfaceFormat = VK_FORMAT_R8G8B8A8_UNORM;
+            if (auto Separator = HeadlessString->find('x'); Separator != std::string_view::npos) {
+                std::from_chars(HeadlessString->data(), HeadlessString->data() + Separator, Self.HeadlessExtent.width);
+                std::from_chars(HeadlessString->data() + Separator + 1, HeadlessString->data() + HeadlessString->size(), Self.HeadlessExtent.height);
+            }
+            if (auto FramesString = env_read_string("KOMPUTE_HEADLESS_FRAMES")) {
+                std::from_chars(FramesString->data(), FramesString->data() + FramesString->size(), Self.HeadlessFrameLimit);
+            }
+            std::println(stdout, "[info]: headless at {}x{} for {} frames", Self.HeadlessExtent.width, Self.HeadlessExtent.height, Self.HeadlessFrameLimit);
+            return;
+        }
+        Self.WindowPlatform = SDL_CreateWindow("Kompute", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 800, 600, SDL_WINDOW_ALLOW_HIGHDPI | SDL_WINDOW_VULKAN | SDL_WINDOW_RESIZABLE);
+        i32 DrawableWidth;
+        i32 DrawableHeight;
+        SDL_Vulkan_GetDrawableSize(Self.WindowPlatform, &DrawableWidth, &DrawableHeight);
+        Self.DrawableExtent = VkExtent2D{u32(DrawableWidth), u32(DrawableHeight)};
+        Self.OnDemandRendering = env_read_string("KOMPUTE_ON_DEMAND").has_value();
+        if (Self.OnDemandRendering) {
+            std::println(stdout, "[info]: rendering on demand");
+        }
     }
 
     void DeleteWindowPlatform(this VulkanApplication& Self) {
+        if (Self.Headless) {
+            return;
+        }
         SDL_DestroyWindow(Self.WindowPlatform);
     }
 
     void CreateVulkanInstance(this VulkanApplication& Self) {
-        Self.ContextDispatcher = new VkContextDispatcher(PFN_vkGetInstanceProcAddr(SDL_Vulkan_GetVkGetInstanceProcAddr()));
+        auto DispatchModeName = env_read_string("KOMPUTE_DISPATCH_MODE").value_or("eager");
+        Self.DispatchMode = VkDispatchMode(std::ranges::find(DISPATCH_MODE_NAMES, DispatchModeName) - std::begin(DISPATCH_MODE_NAMES));
+        if (Self.DispatchMode > VkDispatchMode::Profile) {
+            std::println(stderr, "[warning]: unknown dispatch mode '{}', using eager", DispatchModeName);
+            Self.DispatchMode = VkDispatchMode::Eager;
+        }
+        // Without SDL the loader is opened directly.
+        auto GetInstanceProcAddr = PFN_vkGetInstanceProcAddr();
+        if (Self.Headless) {
+            Self.VulkanLibrary = library_open(VULKAN_LIBRARY_NAME);
+            if (Self.VulkanLibrary == nullptr) {
+                std::println(stderr, "[error]: failed to load {}", VULKAN_LIBRARY_NAME);
+                std::abort();
+            }
+            GetInstanceProcAddr = PFN_vkGetInstanceProcAddr(library_symbol(Self.VulkanLibrary, "vkGetInstanceProcAddr"));
+        } else {
+            GetInstanceProcAddr = PFN_vkGetInstanceProcAddr(SDL_Vulkan_GetVkGetInstanceProcAddr());
+        }
+        Self.ContextDispatcher = new VkContextDispatcher(GetInstanceProcAddr);
         Self.ContextDispatcher->vkEnumerateInstanceLayerProperties(&Self.InstanceLayerPropertyCount, nullptr);
         Self.InstanceLayerProperties = new VkLayerProperties[Self.InstanceLayerPropertyCount];
         Self.ContextDispatcher->vkEnumerateInstanceLayerProperties(&Self.InstanceLayerPropertyCount, Self.InstanceLayerProperties);
 
-        char const* EnabledLayerNames[] = {
-            "VK_LAYER_KHRONOS_validation",
-        };
-        char const* EnabledExtensionNames[] = {
-            "VK_KHR_surface",
-            "VK_EXT_debug_utils",
-            "VK_MVK_macos_surface",
-            "VK_KHR_portability_enumeration",
-            "VK_KHR_get_physical_device_properties2"
-        };
+        u32 InstanceExtensionPropertyCount;
+        Self.ContextDispatcher->vkEnumerateInstanceExtensionProperties(nullptr, &InstanceExtensionPropertyCount, nullptr);
+        auto InstanceExtensionProperties = std::vector<VkExtensionProperties>(InstanceExtensionPropertyCount);
+        Self.ContextDispatcher->vkEnumerateInstanceExtensionProperties(nullptr, &InstanceExtensionPropertyCount, InstanceExtensionProperties.data());
+
+        // Only the surface extensions of a windowed run are required; the rest is enabled where available, so
+        // machines without the validation layers or MoltenVK still get an instance.
+        auto EnabledLayerNames = std::vector<char const*>();
+        if (std::ranges::any_of(std::span(Self.InstanceLayerProperties, Self.InstanceLayerPropertyCount), [](VkLayerProperties const& Properties) {
+            return std::string_view("VK_LAYER_KHRONOS_validation") == Properties.layerName;
+        })) {
+            EnabledLayerNames.push_back("VK_LAYER_KHRONOS_validation");
+        }
+        auto EnabledExtensionNames = std::vector<char const*>();
+        for (auto ExtensionName : {"VK_KHR_surface", "VK_EXT_debug_utils", "VK_MVK_macos_surface", "VK_KHR_portability_enumeration", "VK_KHR_get_physical_device_properties2"}) {
+            bool IsSurfaceExtension = std::string_view(ExtensionName).ends_with("_surface");
+            bool IsSupported = std::ranges::any_of(InstanceExtensionProperties, [ExtensionName](VkExtensionProperties const& Properties) {
+                return std::string_view(ExtensionName) == Properties.extensionName;
+            });
+            if (Self.Headless ? !IsSurfaceExtension && IsSupported : IsSurfaceExtension || IsSupported) {
+                EnabledExtensionNames.push_back(ExtensionName);
+            }
+        }
+        Self.DebugUtilsEnabled = std::ranges::contains(EnabledExtensionNames, std::string_view("VK_EXT_debug_utils"));
+        bool PortabilityEnumerationEnabled = std::ranges::contains(EnabledExtensionNames, std::string_view("VK_KHR_portability_enumeration"));
+
         Self.ContextDispatcher->vkCreateInstance(
             (VkInstanceCreateInfo[]){{
                 .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
-                .flags = VK_INSTANCE_CREATE_ENUMERATE_PORTABILITY_BIT_KHR,
+                .flags = PortabilityEnumerationEnabled ? VK_INSTANCE_CREATE_ENUMERATE_PORTABILITY_BIT_KHR : VkInstanceCreateFlags(),
                 .pApplicationInfo = (VkApplicationInfo[]) {{
                     .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO,
                     .pApplicationName = "Demo",
                     .applicationVersion = VK_MAKE_API_VERSION(1, 0, 0, 0),
                     .pEngineName = "Kompute",
                     .engineVersion = VK_MAKE_API_VERSION(1, 0, 0, 0),
-                    .apiVersion = VK_API_VERSION_1_2
+                    .apiVersion = VULKAN_API_VERSION
                 }},
-                .enabledLayerCount = std::size(EnabledLayerNames),
-                .ppEnabledLayerNames = std::data(EnabledLayerNames),
-                .enabledExtensionCount = std::size(EnabledExtensionNames),
-                .ppEnabledExtensionNames = std::data(EnabledExtensionNames),
+                .enabledLayerCount = u32(EnabledLayerNames.size()),
+                .ppEnabledLayerNames = EnabledLayerNames.data(),
+                .enabledExtensionCount = u32(EnabledExtensionNames.size()),
+                .ppEnabledExtensionNames = EnabledExtensionNames.data(),
             }},
             nullptr,
             &Self.Instance
         );
-        Self.InstanceDispatcher = new VkInstanceDispatcher(Self.ContextDispatcher->vkGetInstanceProcAddr, Self.Instance);
-        Self.InstanceDispatcher->vkCreateDebugUtilsMessengerEXT(
-            Self.Instance,
-            (VkDebugUtilsMessengerCreateInfoEXT[]){{
-                .sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT,
-                .flags = {},
-                .messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
-                .messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_DEVICE_ADDRESS_BINDING_BIT_EXT,
-                .pfnUserCallback = &DebugUtilsCallback
-            }},
-            nullptr,
-            &Self.DebugUtilsMessengerEXT
-        );
+        auto InstanceDispatcherStartTime = std::chrono::steady_clock::now();
+        Self.InstanceDispatcher = new VkInstanceDispatcher(Self.ContextDispatcher->vkGetInstanceProcAddr, Self.Instance, Self.DispatchMode);
+        std::println(stdout, "[info]: instance dispatcher ({}) created in {}", DISPATCH_MODE_NAMES[std::to_underlying(Self.DispatchMode)], std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - InstanceDispatcherStartTime));
+        if (Self.DebugUtilsEnabled) {
+            Self.InstanceDispatcher->vkCreateDebugUtilsMessengerEXT(
+                Self.Instance,
+                (VkDebugUtilsMessengerCreateInfoEXT[]){{
+                    .sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT,
+                    .flags = {},
+                    .messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
+                    .messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_DEVICE_ADDRESS_BINDING_BIT_EXT,
+                    .pfnUserCallback = &DebugUtilsCallback
+                }},
+                nullptr,
+                &Self.DebugUtilsMessengerEXT
+            );
+        }
         Self.InstanceDispatcher->vkEnumeratePhysicalDevices(Self.Instance, &Self.PhysicalDeviceCount, nullptr);
         Self.PhysicalDevices = new VkPhysicalDevice[Self.PhysicalDeviceCount];
         Self.InstanceDispatcher->vkEnumeratePhysicalDevices(Self.Instance, &Self.PhysicalDeviceCount, Self.PhysicalDevices);
 
-        SDL_Vulkan_CreateSurface(Self.WindowPlatform, Self.Instance, &Self.Surface);
+        if (!Self.Headless) {
+            SDL_Vulkan_CreateSurface(Self.WindowPlatform, Self.Instance, &Self.Surface);
+        }
     }
 
     void DeleteVulkanInstance(this VulkanApplication& Self) {
-        Self.InstanceDispatcher->vkDestroySurfaceKHR(Self.Instance, Self.Surface, nullptr);
-        Self.InstanceDispatcher->vkDestroyDebugUtilsMessengerEXT(Self.Instance, Self.DebugUtilsMessengerEXT, nullptr);
+        if (!Self.Headless) {
+            Self.InstanceDispatcher->vkDestroySurfaceKHR(Self.Instance, Self.Surface, nullptr);
+        }
+        if (Self.DebugUtilsEnabled) {
+            Self.InstanceDispatcher->vkDestroyDebugUtilsMessengerEXT(Self.Instance, Self.DebugUtilsMessengerEXT, nullptr);
+        }
         Self.InstanceDispatcher->vkDestroyInstance(Self.Instance, nullptr);
+        delete Self.InstanceDispatcher;
+        delete Self.ContextDispatcher;
         delete[] Self.PhysicalDevices;
         delete[] Self.InstanceLayerProperties;
+        if (Self.Headless) {
+            library_close(Self.VulkanLibrary);
+        }
     }
 
     void CreateLogicalDevice(this VulkanApplication& Self) {
-        auto EnabledExtensionNames = std::array{
+        auto EnabledExtensionNames = std::vector<char const*>{
             "VK_KHR_swapchain",
             "VK_KHR_copy_commands2",
             "VK_KHR_synchronization2",
@@ -153,7 +521,151 @@ struct VulkanApplication {
 
         Self.PhysicalDevice = Self.PhysicalDevices[0];
         Self.QueueIndex = 0;
+
+        // The main queue dispatches (unless async compute is on), blits and presents, so it needs a family that can
+        // present to the surface. Async compute (KOMPUTE_ASYNC_COMPUTE) moves the dispatch to a family without
+        // graphics, which drivers map to a separate hardware queue.
+        u32 QueueFamilyPropertyCount;
+        Self.InstanceDispatcher->vkGetPhysicalDeviceQueueFamilyProperties(Self.PhysicalDevice, &QueueFamilyPropertyCount, nullptr);
+        auto QueueFamilyProperties = std::vector<VkQueueFamilyProperties>(QueueFamilyPropertyCount);
+        Self.InstanceDispatcher->vkGetPhysicalDeviceQueueFamilyProperties(Self.PhysicalDevice, &QueueFamilyPropertyCount, QueueFamilyProperties.data());
         Self.QueueFamilyIndex = 0;
+        for (u32 i = 0; i < QueueFamilyPropertyCount; i += 1) {
+            VkBool32 SurfaceSupported = Self.Headless ? VK_TRUE : VK_FALSE;
+            if (!Self.Headless) {
+                Self.InstanceDispatcher->vkGetPhysicalDeviceSurfaceSupportKHR(Self.PhysicalDevice, i, Self.Surface, &SurfaceSupported);
+            }
+            if (SurfaceSupported == VK_TRUE && (QueueFamilyProperties[i].queueFlags & VK_QUEUE_COMPUTE_BIT) != 0) {
+                Self.QueueFamilyIndex = i;
+                break;
+            }
+        }
+        Self.ComputeQueueFamilyIndex = Self.QueueFamilyIndex;
+        for (u32 i = 0; i < QueueFamilyPropertyCount; i += 1) {
+            if ((QueueFamilyProperties[i].queueFlags & VK_QUEUE_COMPUTE_BIT) != 0 && (QueueFamilyProperties[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0) {
+                Self.ComputeQueueFamilyIndex = i;
+                break;
+            }
+        }
+        Self.AsyncCompute = false;
+        if (env_read_string("KOMPUTE_ASYNC_COMPUTE")) {
+            if (Self.ComputeQueueFamilyIndex != Self.QueueFamilyIndex) {
+                Self.AsyncCompute = true;
+            } else {
+                std::println(stderr, "[warning]: no dedicated compute queue family, async compute is disabled");
+            }
+        }
+        std::println(stdout, "[info]: main queue family {}, compute queue family {}{}", Self.QueueFamilyIndex, Self.ComputeQueueFamilyIndex, Self.AsyncCompute ? " (async compute)" : "");
+
+        u32 DeviceExtensionPropertyCount;
+        Self.InstanceDispatcher->vkEnumerateDeviceExtensionProperties(Self.PhysicalDevice, nullptr, &DeviceExtensionPropertyCount, nullptr);
+        auto DeviceExtensionProperties = std::vector<VkExtensionProperties>(DeviceExtensionPropertyCount);
+        Self.InstanceDispatcher->vkEnumerateDeviceExtensionProperties(Self.PhysicalDevice, nullptr, &DeviceExtensionPropertyCount, DeviceExtensionProperties.data());
+        auto IsDeviceExtensionSupported = [&](std::string_view Name) {
+            return std::ranges::any_of(DeviceExtensionProperties, [Name](VkExtensionProperties const& Properties) {
+                return Name == Properties.extensionName;
+            });
+        };
+        std::erase_if(EnabledExtensionNames, [&](std::string_view Name) {
+            return Name == "VK_KHR_portability_subset" ? !IsDeviceExtensionSupported(Name) : Name == "VK_KHR_swapchain" && Self.Headless;
+        });
+
+        // Prefer descriptor buffers, then push descriptors; KOMPUTE_DESCRIPTOR_STRATEGY picks one explicitly if the device supports it.
+        auto SupportedDescriptorBufferFeatures = VkPhysicalDeviceDescriptorBufferFeaturesEXT{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT,
+            .pNext = {}
+        };
+        if (IsDeviceExtensionSupported("VK_EXT_descriptor_buffer")) {
+            Self.InstanceDispatcher->vkGetPhysicalDeviceFeatures2(
+                Self.PhysicalDevice,
+                (VkPhysicalDeviceFeatures2[]){{
+                    .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+                    .pNext = &SupportedDescriptorBufferFeatures
+                }}
+            );
+        }
+        bool SupportedDescriptorStrategies[] = {
+            true,
+            IsDeviceExtensionSupported("VK_KHR_push_descriptor"),
+            SupportedDescriptorBufferFeatures.descriptorBuffer == VK_TRUE,
+        };
+        Self.ComputeDescriptorStrategy = SupportedDescriptorStrategies[2] ? DescriptorStrategy::Buffer : SupportedDescriptorStrategies[1] ? DescriptorStrategy::Push : DescriptorStrategy::Persistent;
+        if (auto DescriptorStrategyName = env_read_string("KOMPUTE_DESCRIPTOR_STRATEGY")) {
+            auto Index = usize(std::ranges::find(DESCRIPTOR_STRATEGY_NAMES, *DescriptorStrategyName) - std::begin(DESCRIPTOR_STRATEGY_NAMES));
+            if (Index < std::size(DESCRIPTOR_STRATEGY_NAMES) && SupportedDescriptorStrategies[Index]) {
+                Self.ComputeDescriptorStrategy = DescriptorStrategy(Index);
+            } else {
+                std::println(stderr, "[warning]: descriptor strategy '{}' is not supported, using {}", *DescriptorStrategyName, DESCRIPTOR_STRATEGY_NAMES[std::to_underlying(Self.ComputeDescriptorStrategy)]);
+            }
+        }
+        std::println(stdout, "[info]: descriptor strategy: {}", DESCRIPTOR_STRATEGY_NAMES[std::to_underlying(Self.ComputeDescriptorStrategy)]);
+
+        // VK_KHR_present_id and VK_KHR_present_wait let the loop block until a given frame is on screen.
+        auto SupportedPresentIdFeatures = VkPhysicalDevicePresentIdFeaturesKHR{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+            .pNext = {}
+        };
+        auto SupportedPresentWaitFeatures = VkPhysicalDevicePresentWaitFeaturesKHR{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR,
+            .pNext = &SupportedPresentIdFeatures
+        };
+        if (IsDeviceExtensionSupported("VK_KHR_present_id") && IsDeviceExtensionSupported("VK_KHR_present_wait")) {
+            Self.InstanceDispatcher->vkGetPhysicalDeviceFeatures2(
+                Self.PhysicalDevice,
+                (VkPhysicalDeviceFeatures2[]){{
+                    .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+                    .pNext = &SupportedPresentWaitFeatures
+                }}
+            );
+        }
+        Self.PresentWaitEnabled = SupportedPresentIdFeatures.presentId == VK_TRUE && SupportedPresentWaitFeatures.presentWait == VK_TRUE && !Self.Headless;
+
+        // VK_KHR_incremental_present tells the presentation engine which parts of a presented image changed.
+        Self.IncrementalPresentEnabled = IsDeviceExtensionSupported("VK_KHR_incremental_present") && !Self.Headless;
+        if (Self.IncrementalPresentEnabled) {
+            EnabledExtensionNames.push_back("VK_KHR_incremental_present");
+        }
+
+        // ps.comp writes its image without a format qualifier, so one shader serves the BGRA swapchain images and the
+        // RGBA ComputeImage. Devices that cannot write unformatted storage images load the rgba8 build of it, which only
+        // fits RGBA images.
+        VkPhysicalDeviceFeatures SupportedFeatures;
+        Self.InstanceDispatcher->vkGetPhysicalDeviceFeatures(Self.PhysicalDevice, &SupportedFeatures);
+        Self.StorageWriteWithoutFormat = SupportedFeatures.shaderStorageImageWriteWithoutFormat == VK_TRUE;
+        Self.ComputeShaderBinary = Self.StorageWriteWithoutFormat ? COMPUTE_SHADER_BINARY : COMPUTE_SHADER_FORMATTED_BINARY;
+        if (!Self.StorageWriteWithoutFormat) {
+            std::println(stderr, "[warning]: no shaderStorageImageWriteWithoutFormat, using {}", COMPUTE_SHADER_FORMATTED_BINARY);
+        }
+
+        // KOMPUTE_GPU_TRACE and dynamic resolution need timestamps on every queue that records a scope, which includes
+        // the compute family only with async compute.
+        // VK_EXT_calibrated_timestamps puts them on the steady_clock timeline (CLOCK_MONOTONIC) for the trace; without
+        // it they are anchored at a frame's submit.
+        Self.TimestampsSupported = QueueFamilyProperties[Self.QueueFamilyIndex].timestampValidBits != 0
+                                && (!Self.AsyncCompute || QueueFamilyProperties[Self.ComputeQueueFamilyIndex].timestampValidBits != 0);
+        Self.GpuProfilerEnabled = false;
+        Self.CalibratedTimestampsEnabled = false;
+        bool GpuTraceRequested = env_read_string("KOMPUTE_GPU_TRACE").has_value();
+        if (GpuTraceRequested || Self.DynamicResolution) {
+            Self.GpuProfilerEnabled = Self.TimestampsSupported;
+            if (!Self.GpuProfilerEnabled) {
+                std::println(stderr, "[warning]: queue family has no timestamps, the trace is CPU only and dynamic resolution is disabled");
+                Self.DynamicResolution = false;
+            }
+#if defined(__linux__)
+            if (Self.GpuProfilerEnabled && GpuTraceRequested && IsDeviceExtensionSupported("VK_EXT_calibrated_timestamps")) {
+                u32 TimeDomainCount;
+                Self.InstanceDispatcher->vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(Self.PhysicalDevice, &TimeDomainCount, nullptr);
+                auto TimeDomains = std::vector<VkTimeDomainEXT>(TimeDomainCount);
+                Self.InstanceDispatcher->vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(Self.PhysicalDevice, &TimeDomainCount, TimeDomains.data());
+                Self.CalibratedTimestampsEnabled = std::ranges::contains(TimeDomains, VK_TIME_DOMAIN_DEVICE_EXT)
+                                                && std::ranges::contains(TimeDomains, VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT);
+            }
+#endif
+            if (Self.CalibratedTimestampsEnabled) {
+                EnabledExtensionNames.push_back("VK_EXT_calibrated_timestamps");
+            }
+        }
 
         auto QueueCreateInfos = std::array{
             VkDeviceQueueCreateInfo{
@@ -162,6 +674,13 @@ struct VulkanApplication {
                 .queueFamilyIndex = Self.QueueFamilyIndex,
                 .queueCount = 1,
                 .pQueuePriorities = (f32[]) {1.0f}
+            },
+            VkDeviceQueueCreateInfo{
+                .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+                .pNext = {},
+                .queueFamilyIndex = Self.ComputeQueueFamilyIndex,
+                .queueCount = 1,
+                .pQueuePriorities = (f32[]) {1.0f}
             }
         };
 
@@ -180,29 +699,86 @@ struct VulkanApplication {
             .pNext = &Core_1_2,
             .synchronization2 = VK_TRUE
         };
+        auto DescriptorBufferFeatures = VkPhysicalDeviceDescriptorBufferFeaturesEXT{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT,
+            .pNext = &Core_1_3,
+            .descriptorBuffer = VK_TRUE
+        };
         auto Features2 = VkPhysicalDeviceFeatures2{
             .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
             .pNext = &Core_1_3,
             .features = {
+                .shaderStorageImageWriteWithoutFormat = Self.StorageWriteWithoutFormat ? VK_TRUE : VK_FALSE,
                 .shaderInt64 = VK_TRUE
             }
         };
+        switch (Self.ComputeDescriptorStrategy) {
+        case DescriptorStrategy::Persistent: {
+            break;
+        }
+        case DescriptorStrategy::Push: {
+            EnabledExtensionNames.push_back("VK_KHR_push_descriptor");
+            break;
+        }
+        case DescriptorStrategy::Buffer: {
+            EnabledExtensionNames.push_back("VK_EXT_descriptor_buffer");
+            Features2.pNext = &DescriptorBufferFeatures;
+
+            Self.DescriptorBufferProperties = VkPhysicalDeviceDescriptorBufferPropertiesEXT{
+                .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT,
+                .pNext = {}
+            };
+            Self.InstanceDispatcher->vkGetPhysicalDeviceProperties2(
+                Self.PhysicalDevice,
+                (VkPhysicalDeviceProperties2[]){{
+                    .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+                    .pNext = &Self.DescriptorBufferProperties
+                }}
+            );
+            break;
+        }
+        }
+        auto PresentIdFeatures = VkPhysicalDevicePresentIdFeaturesKHR{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+            .pNext = Features2.pNext,
+            .presentId = VK_TRUE
+        };
+        auto PresentWaitFeatures = VkPhysicalDevicePresentWaitFeaturesKHR{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR,
+            .pNext = &PresentIdFeatures,
+            .presentWait = VK_TRUE
+        };
+        if (Self.PresentWaitEnabled) {
+            EnabledExtensionNames.push_back("VK_KHR_present_id");
+            EnabledExtensionNames.push_back("VK_KHR_present_wait");
+            Features2.pNext = &PresentWaitFeatures;
+        }
         Self.InstanceDispatcher->vkCreateDevice(
             Self.PhysicalDevice,
             (VkDeviceCreateInfo[]){{
                 .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
                 .pNext = &Features2,
-                .queueCreateInfoCount = QueueCreateInfos.size(),
+                .queueCreateInfoCount = Self.AsyncCompute ? 2u : 1u,
                 .pQueueCreateInfos = QueueCreateInfos.data(),
                 .enabledLayerCount = 0,
                 .ppEnabledLayerNames = {},
-                .enabledExtensionCount = EnabledExtensionNames.size(),
+                .enabledExtensionCount = u32(EnabledExtensionNames.size()),
                 .ppEnabledExtensionNames = EnabledExtensionNames.data()
             }},
             nullptr,
             &Self.LogicalDevice
         );
-        Self.DeviceDispatcher = new VkDeviceDispatcher(Self.InstanceDispatcher->vkGetDeviceProcAddr, Self.LogicalDevice);
+        auto DeviceDispatcherStartTime = std::chrono::steady_clock::now();
+        Self.DeviceDispatcher = new VkDeviceDispatcher(
+            Self.InstanceDispatcher->vkGetDeviceProcAddr,
+            Self.LogicalDevice,
+            VkDispatchFeatures{
+                .apiVersion = VULKAN_API_VERSION,
+                .extensions = EnabledExtensionNames
+            },
+            Self.DispatchMode
+        );
+        std::println(stdout, "[info]: device dispatcher ({}) created in {}", DISPATCH_MODE_NAMES[std::to_underlying(Self.DispatchMode)], std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - DeviceDispatcherStartTime));
         Self.DeviceDispatcher->vkGetDeviceQueue2(
             Self.LogicalDevice,
             (VkDeviceQueueInfo2[]){{
@@ -214,135 +790,752 @@ struct VulkanApplication {
             }},
             &Self.Queue
         );
+        Self.ComputeQueue = Self.Queue;
+        if (Self.AsyncCompute) {
+            Self.DeviceDispatcher->vkGetDeviceQueue2(
+                Self.LogicalDevice,
+                (VkDeviceQueueInfo2[]){{
+                    .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2,
+                    .pNext = {},
+                    .flags = {},
+                    .queueFamilyIndex = Self.ComputeQueueFamilyIndex,
+                    .queueIndex = 0
+                }},
+                &Self.ComputeQueue
+            );
+        }
+
+        // Read by the GPU profiler, the pipeline cache and the workgroup tuner.
+        Self.PhysicalDeviceIdProperties = VkPhysicalDeviceIDProperties{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES,
+            .pNext = {}
+        };
+        auto PhysicalDeviceProperties2 = VkPhysicalDeviceProperties2{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+            .pNext = &Self.PhysicalDeviceIdProperties
+        };
+        Self.InstanceDispatcher->vkGetPhysicalDeviceProperties2(Self.PhysicalDevice, &PhysicalDeviceProperties2);
+        Self.PhysicalDeviceProperties = PhysicalDeviceProperties2.properties;
+    }
+
+    // KOMPUTE_FRAMES_IN_FLIGHT=N allocates N frame slots and lets the CPU run up to N frames ahead of the GPU.
+    // KOMPUTE_ADAPTIVE_FRAMES_IN_FLIGHT keeps the N slots but moves the depth between 1 and N at runtime, following
+    // the time the loop spends waiting on the timeline for a slot (FramesInFlightController). Only the wait value
+    // changes, so nothing is reallocated.
+    void SelectFramesInFlight(this VulkanApplication& Self) {
+        Self.FrameSlotCount = DEFAULT_FRAMES_IN_FLIGHT;
+        if (auto FrameCountString = env_read_string("KOMPUTE_FRAMES_IN_FLIGHT")) {
+            u32 FrameCount = 0;
+            std::from_chars(FrameCountString->data(), FrameCountString->data() + FrameCountString->size(), FrameCount);
+            if (FrameCount >= 1 && FrameCount <= MAX_FRAMES_IN_FLIGHT) {
+                Self.FrameSlotCount = FrameCount;
+            } else {
+                std::println(stderr, "[warning]: frames in flight '{}' is outside [1, {}], using {}", *FrameCountString, MAX_FRAMES_IN_FLIGHT, Self.FrameSlotCount);
+            }
+        }
+        Self.FramesInFlight = Self.FrameSlotCount;
+        Self.AdaptiveFramesInFlight = env_read_string("KOMPUTE_ADAPTIVE_FRAMES_IN_FLIGHT").has_value();
+        Self.AdaptiveDepth = FramesInFlightController{
+            .MaxDepth = Self.FrameSlotCount,
+            .Depth = Self.FramesInFlight
+        };
+        Self.AdaptiveWindowFrames = 0;
+        Self.AdaptiveWaitTime = {};
+        Self.AdaptiveWindowStart = std::chrono::steady_clock::now();
+        std::println(stdout, "[info]: {} frames in flight{}", Self.FrameSlotCount, Self.AdaptiveFramesInFlight ? " (adaptive)" : "");
+    }
+
+    // Called once per frame with the time spent waiting for the frame's slot.
+    void AdaptFramesInFlight(this VulkanApplication& Self, std::chrono::steady_clock::duration WaitTime) {
+        if (!Self.AdaptiveFramesInFlight) {
+            return;
+        }
+        Self.AdaptiveWaitTime += WaitTime;
+        Self.AdaptiveWindowFrames += 1;
+        if (Self.AdaptiveWindowFrames < ADAPTIVE_FRAMES_IN_FLIGHT_WINDOW) {
+            return;
+        }
+        auto Now = std::chrono::steady_clock::now();
+        auto WaitShare = std::chrono::duration<f64>(Self.AdaptiveWaitTime) / std::chrono::duration<f64>(Now - Self.AdaptiveWindowStart);
+        if (Self.AdaptiveDepth.Update(WaitShare)) {
+            std::println(stdout, "[info]: frames in flight {} -> {} ({:.0f}% of the frame waiting on the GPU)", Self.FramesInFlight, Self.AdaptiveDepth.Depth, WaitShare * 100.0);
+            Self.FramesInFlight = Self.AdaptiveDepth.Depth;
+        }
+        Self.AdaptiveWindowFrames = 0;
+        Self.AdaptiveWaitTime = {};
+        Self.AdaptiveWindowStart = Now;
+    }
+
+    // Compares the cost of one cheap device call through each dispatch path.
+    void BenchmarkDispatch(this VulkanApplication& Self) {
+        auto Measure = [](char const* Name, auto&& Call) {
+            auto StartTime = std::chrono::steady_clock::now();
+            for (u32 i = 0; i < DISPATCH_BENCHMARK_ITERATIONS; i += 1) {
+                Call();
+            }
+            auto Seconds = std::chrono::duration<f64>(std::chrono::steady_clock::now() - StartTime).count();
+            std::println(stdout, "[info]: {}: {:.1f}M calls/s", Name, f64(DISPATCH_BENCHMARK_ITERATIONS) / Seconds / 1e6);
+        };
+
+        VkQueue Queue;
+        auto LoaderGetDeviceQueue = PFN_vkGetDeviceQueue(Self.ContextDispatcher->vkGetInstanceProcAddr(Self.Instance, "vkGetDeviceQueue"));
+        Measure("loader export", [&] {
+            LoaderGetDeviceQueue(Self.LogicalDevice, Self.QueueFamilyIndex, Self.QueueIndex, &Queue);
+        });
+        Measure("device dispatcher", [&] {
+            Self.DeviceDispatcher->vkGetDeviceQueue(Self.LogicalDevice, Self.QueueFamilyIndex, Self.QueueIndex, &Queue);
+        });
+        Measure("vkh trampoline", [&] {
+            Self.LogicalDevice->GetDeviceQueue(Self.QueueFamilyIndex, Self.QueueIndex, &Queue);
+        });
     }
 
     void DeleteLogicalDevice(this VulkanApplication& Self) {
+        if (Self.DispatchMode == VkDispatchMode::Profile) {
+            VkDeviceDispatcher::dumpProfile(stdout);
+        }
         Self.DeviceDispatcher->vkDestroyDevice(Self.LogicalDevice, nullptr);
+        delete Self.DeviceDispatcher;
     }
 
-    void CreateDeviceObjects(this VulkanApplication& Self) {
-        Self.Fences = new VkFence[MAX_FRAMES_IN_FLIGHT];
-        Self.SubmitSemaphores = new VkSemaphore[MAX_FRAMES_IN_FLIGHT];
-        Self.AcquireSemaphores = new VkSemaphore[MAX_FRAMES_IN_FLIGHT];
-        Self.CommandPools = new VkCommandPool[MAX_FRAMES_IN_FLIGHT];
-        Self.CommandBuffers = new VkCommandBuffer[MAX_FRAMES_IN_FLIGHT];
-        Self.DescriptorPools = new VkDescriptorPool[MAX_FRAMES_IN_FLIGHT];
-        Self.DeviceDispatcher->vkCreateSemaphore(
+    // KOMPUTE_GPU_TRACE=path writes a Chrome trace (chrome://tracing, ui.perfetto.dev) of the CPU frame phases and
+    // the GPU scopes of the first KOMPUTE_GPU_TRACE_FRAMES frames. Each frame slot owns a range of timestamp queries
+    // that is read back once the slot's timeline value has been waited for, so the readback never stalls.
+    void CreateGpuProfiler(this VulkanApplication& Self) {
+        Self.TimestampCalibrated = false;
+        std::ranges::fill(Self.TimestampQueryFrames, 0);
+        std::ranges::fill(Self.TimestampQueryDispatched, false);
+        std::ranges::fill(Self.GpuScopeMilliseconds, 0.0);
+        std::ranges::fill(Self.GpuScopeSamples, 0);
+        if (env_read_string("KOMPUTE_GPU_TRACE")) {
+            Self.Trace.FrameLimit = GPU_TRACE_DEFAULT_FRAMES;
+            if (auto FramesString = env_read_string("KOMPUTE_GPU_TRACE_FRAMES")) {
+                std::from_chars(FramesString->data(), FramesString->data() + FramesString->size(), Self.Trace.FrameLimit);
+            }
+            Self.Timings.Trace = &Self.Trace;
+        }
+        Self.TimestampQueryPool = VK_NULL_HANDLE;
+        if (!Self.GpuProfilerEnabled) {
+            return;
+        }
+
+        Self.TimestampPeriod = f64(Self.PhysicalDeviceProperties.limits.timestampPeriod);
+
+        Self.DeviceDispatcher->vkCreateQueryPool(
             Self.LogicalDevice,
-            (VkSemaphoreCreateInfo[]){{
-                .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
-                .pNext = (VkSemaphoreTypeCreateInfo[]){{
-                    .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
-                    .pNext = {},
-                    .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
-                    .initialValue = 0
-                }}
+            (VkQueryPoolCreateInfo[]){{
+                .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                .pNext = {},
+                .flags = {},
+                .queryType = VK_QUERY_TYPE_TIMESTAMP,
+                .queryCount = Self.FrameSlotCount * GPU_SCOPE_QUERY_COUNT,
+                .pipelineStatistics = {}
             }},
             nullptr,
-            &Self.TimelineSemaphore
+            &Self.TimestampQueryPool
         );
-        for (u32 i = 0; i < MAX_FRAMES_IN_FLIGHT; i += 1) {
-            Self.DeviceDispatcher->vkCreateFence(
-                Self.LogicalDevice,
-                (VkFenceCreateInfo[]){{
-                    .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
-                    .flags = {},
-                }},
-                nullptr,
-                &Self.Fences[i]
-            );
-            Self.DeviceDispatcher->vkCreateSemaphore(
+
+        if (Self.CalibratedTimestampsEnabled) {
+            u64 Timestamps[2];
+            u64 MaxDeviation;
+            Self.DeviceDispatcher->vkGetCalibratedTimestampsEXT(
                 Self.LogicalDevice,
-                (VkSemaphoreCreateInfo[]){{
-                    .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
-                    .pNext = (VkSemaphoreTypeCreateInfo[]){{
-                        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+                2, (VkCalibratedTimestampInfoEXT[]){
+                    VkCalibratedTimestampInfoEXT{
+                        .sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT,
                         .pNext = {},
-                        .semaphoreType = VK_SEMAPHORE_TYPE_BINARY,
-                    }}
-                }},
-                nullptr,
-                &Self.SubmitSemaphores[i]
-            );
-            Self.DeviceDispatcher->vkCreateSemaphore(
-                Self.LogicalDevice,
-                (VkSemaphoreCreateInfo[]){{
-                    .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
-                    .pNext = (VkSemaphoreTypeCreateInfo[]){{
-                        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+                        .timeDomain = VK_TIME_DOMAIN_DEVICE_EXT
+                    },
+                    VkCalibratedTimestampInfoEXT{
+                        .sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT,
                         .pNext = {},
-                        .semaphoreType = VK_SEMAPHORE_TYPE_BINARY,
-                    }}
-                }},
-                nullptr,
-                &Self.AcquireSemaphores[i]
-            );
-            Self.DeviceDispatcher->vkCreateCommandPool(
-                Self.LogicalDevice,
-                (VkCommandPoolCreateInfo[]){{
-                    .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
-                    .pNext = {},
-                    .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
-                    .queueFamilyIndex = Self.QueueFamilyIndex
-                }},
-                nullptr,
-                &Self.CommandPools[i]
-            );
-            Self.DeviceDispatcher->vkAllocateCommandBuffers(
-                Self.LogicalDevice,
-                (VkCommandBufferAllocateInfo[]){{
-                    .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
-                    .commandPool = Self.CommandPools[i],
-                    .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
-                    .commandBufferCount = 1,
-                }},
-                &Self.CommandBuffers[i]
-            );
-            Self.DeviceDispatcher->vkCreateDescriptorPool(
-                Self.LogicalDevice,
-                (VkDescriptorPoolCreateInfo[]){{
-                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
-                    .pNext = {},
-                    .flags = {},
-                    .maxSets = 1,
-                    .poolSizeCount = 1,
-                    .pPoolSizes = (VkDescriptorPoolSize[]) {
-                        VkDescriptorPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1)
+                        .timeDomain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT
                     }
-                }},
-                nullptr,
-                &Self.DescriptorPools[i]
+                },
+                Timestamps,
+                &MaxDeviation
             );
+            Self.TimestampCalibrationTicks = Timestamps[0];
+            Self.TimestampCalibrationNanoseconds = i64(Timestamps[1]);
+            Self.TimestampCalibrated = true;
+            std::println(stdout, "[info]: GPU timestamps calibrated to CLOCK_MONOTONIC, max deviation {} ns", MaxDeviation);
+        } else if (Self.Timings.Trace != nullptr) {
+            std::println(stderr, "[warning]: no calibrated timestamps, GPU scopes are anchored at the first traced submit");
         }
     }
 
-    void DeleteDeviceObjects(this VulkanApplication& Self) {
-        for (u32 i = 0; i < MAX_FRAMES_IN_FLIGHT; i += 1) {
-            Self.DeviceDispatcher->vkDestroyFence(Self.LogicalDevice, Self.Fences[i], nullptr);
-            Self.DeviceDispatcher->vkDestroyCommandPool(Self.LogicalDevice, Self.CommandPools[i], nullptr);
-            Self.DeviceDispatcher->vkDestroySemaphore(Self.LogicalDevice, Self.SubmitSemaphores[i], nullptr);
-            Self.DeviceDispatcher->vkDestroySemaphore(Self.LogicalDevice, Self.AcquireSemaphores[i], nullptr);
-            Self.DeviceDispatcher->vkDestroyDescriptorPool(Self.LogicalDevice, Self.DescriptorPools[i], nullptr);
+    // The profiler may have been turned off since, when only workgroup tuning needed it.
+    void DeleteGpuProfiler(this VulkanApplication& Self) {
+        if (Self.TimestampQueryPool != VK_NULL_HANDLE) {
+            Self.DeviceDispatcher->vkDestroyQueryPool(Self.LogicalDevice, Self.TimestampQueryPool, nullptr);
         }
-        Self.DeviceDispatcher->vkDestroySemaphore(Self.LogicalDevice, Self.TimelineSemaphore, nullptr);
-        delete[] Self.Fences;
-        delete[] Self.CommandPools;
-        delete[] Self.CommandBuffers;
-        delete[] Self.DescriptorPools;
-        delete[] Self.SubmitSemaphores;
-        delete[] Self.AcquireSemaphores;
     }
 
-    void CreateVulkanShaders(this VulkanApplication& Self) {
-        auto ComputeShaderBytes = file_read_bytes("../shaders/ps.comp.spv").value();
+    void ResetGpuScopes(this VulkanApplication& Self, VkCommandBuffer CommandBuffer, u32 FrameIndex, GpuScope First, GpuScope Last) {
+        if (Self.GpuProfilerEnabled) {
+            u32 FirstQuery = FrameIndex * GPU_SCOPE_QUERY_COUNT + 2 * std::to_underlying(First);
+            Self.DeviceDispatcher->vkCmdResetQueryPool(CommandBuffer, Self.TimestampQueryPool, FirstQuery, 2 * (std::to_underlying(Last) - std::to_underlying(First) + 1));
+        }
+    }
 
-        Self.DeviceDispatcher->vkCreateDescriptorSetLayout(
+    void WriteGpuTimestamp(this VulkanApplication& Self, VkCommandBuffer CommandBuffer, u32 FrameIndex, GpuScope Scope, bool End) {
+        if (Self.GpuProfilerEnabled) {
+            u32 Query = FrameIndex * GPU_SCOPE_QUERY_COUNT + 2 * std::to_underlying(Scope) + u32(End);
+            Self.DeviceDispatcher->vkCmdWriteTimestamp2(CommandBuffer, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, Self.TimestampQueryPool, Query);
+        }
+    }
+
+    // Called right before the first submit of a frame; the time is the anchor when timestamps are not calibrated.
+    void SubmitGpuScopes(this VulkanApplication& Self, u32 FrameIndex, u32 TotalFrameIndex) {
+        if (Self.GpuProfilerEnabled) {
+            Self.TimestampQueryFrames[FrameIndex] = u64(TotalFrameIndex) + 1;
+            Self.TimestampQueryDispatched[FrameIndex] = !Self.DispatchRects.empty();
+            Self.TimestampQueryPixels[FrameIndex] = u64(Self.RenderExtent.width) * u64(Self.RenderExtent.height);
+            Self.TimestampQuerySubmitTimes[FrameIndex] = FrameTrace::Now();
+        }
+    }
+
+    // The slot's previous frame must be complete. Scopes the frame did not record (the blit on the direct path)
+    // stay unavailable and are skipped.
+    void ReadGpuScopes(this VulkanApplication& Self, u32 FrameIndex) {
+        if (Self.TimestampQueryFrames[FrameIndex] == 0) {
+            return;
+        }
+        u64 Frame = Self.TimestampQueryFrames[FrameIndex] - 1;
+        Self.TimestampQueryFrames[FrameIndex] = 0;
+
+        // Pairs of timestamp and availability.
+        u64 Results[GPU_SCOPE_QUERY_COUNT][2];
+        Self.DeviceDispatcher->vkGetQueryPoolResults(
             Self.LogicalDevice,
-            (VkDescriptorSetLayoutCreateInfo[]){{
-                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
-                .pNext = {},
-                .flags = {},
-                .bindingCount = 1,
+            Self.TimestampQueryPool,
+            FrameIndex * GPU_SCOPE_QUERY_COUNT,
+            GPU_SCOPE_QUERY_COUNT,
+            sizeof(Results),
+            Results,
+            sizeof(Results[0]),
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT
+        );
+        if (!Self.TimestampCalibrated && Results[0][1] != 0) {
+            Self.TimestampCalibrationTicks = Results[0][0];
+            Self.TimestampCalibrationNanoseconds = Self.TimestampQuerySubmitTimes[FrameIndex];
+            Self.TimestampCalibrated = true;
+        }
+        auto ToNanoseconds = [&](u64 Ticks) -> i64 {
+            return Self.TimestampCalibrationNanoseconds + i64(f64(i64(Ticks - Self.TimestampCalibrationTicks)) * Self.TimestampPeriod);
+        };
+        auto FrameBeginTicks = std::numeric_limits<u64>::max();
+        auto FrameEndTicks = std::numeric_limits<u64>::min();
+        auto DispatchMilliseconds = -1.0;
+        for (u32 i = 0; i < std::size(GPU_SCOPE_NAMES); i += 1) {
+            if (Results[2 * i][1] == 0 || Results[2 * i + 1][1] == 0) {
+                continue;
+            }
+            FrameBeginTicks = std::min(FrameBeginTicks, Results[2 * i][0]);
+            FrameEndTicks = std::max(FrameEndTicks, Results[2 * i + 1][0]);
+            auto BeginNanoseconds = ToNanoseconds(Results[2 * i][0]);
+            auto EndNanoseconds = ToNanoseconds(Results[2 * i + 1][0]);
+            bool OnComputeQueue = Self.AsyncCompute && GpuScope(i) <= GpuScope::Dispatch;
+            Self.Trace.Add(GPU_SCOPE_NAMES[i], OnComputeQueue ? TraceTrack::GpuCompute : TraceTrack::Gpu, Frame, BeginNanoseconds, EndNanoseconds);
+            Self.GpuScopeMilliseconds[i] += f64(EndNanoseconds - BeginNanoseconds) / 1e6;
+            Self.GpuScopeSamples[i] += 1;
+            if (GpuScope(i) == GpuScope::Dispatch) {
+                DispatchMilliseconds = f64(EndNanoseconds - BeginNanoseconds) / 1e6;
+            }
+        }
+        if (auto Candidate = std::exchange(Self.WorkgroupSlotCandidates[FrameIndex], u32(-1)); Candidate != u32(-1) && DispatchMilliseconds >= 0.0) {
+            Self.WorkgroupCandidateSamples[Candidate].push_back(DispatchMilliseconds * 1e6 / f64(Self.TimestampQueryPixels[FrameIndex]));
+        }
+        // The scale holds while tuning, so candidates render the same area.
+        if (Self.DynamicResolution && !Self.WorkgroupTuning && FrameBeginTicks < FrameEndTicks) {
+            Self.RenderScale.Update(f64(FrameEndTicks - FrameBeginTicks) * Self.TimestampPeriod / 1e6, Self.TimestampQueryDispatched[FrameIndex]);
+        }
+    }
+
+    // KOMPUTE_WORKGROUP_SIZE=XxY fixes the workgroup size. Otherwise the size saved in WORKGROUP_TUNING_PATH for this
+    // device (deviceUUID) and driver version is used; without one, the first frames time every candidate that fits
+    // the device with GPU timestamps and save the fastest. KOMPUTE_WORKGROUP_TUNING=retune ignores the saved size and
+    // =off keeps the default. Tuning needs timestamps and is skipped while shaders hot reload.
+    void SelectWorkgroupSize(this VulkanApplication& Self) {
+        auto const& Limits = Self.PhysicalDeviceProperties.limits;
+        auto Fits = [&](VkExtent2D Size) {
+            return Size.width != 0 && Size.height != 0
+                && Size.width <= Limits.maxComputeWorkGroupSize[0]
+                && Size.height <= Limits.maxComputeWorkGroupSize[1]
+                && Size.width * Size.height <= Limits.maxComputeWorkGroupInvocations;
+        };
+        auto ParseSize = [](std::string_view String) {
+            auto Size = VkExtent2D{0, 0};
+            if (auto Separator = String.find('x'); Separator != std::string_view::npos) {
+                std::from_chars(String.data(), String.data() + Separator, Size.width);
+                std::from_chars(String.data() + Separator + 1, String.data() + String.size(), Size.height);
+            }
+            return Size;
+        };
+
+        Self.WorkgroupTuningKey.clear();
+        for (auto Byte : Self.PhysicalDeviceIdProperties.deviceUUID) {
+            std::format_to(std::back_inserter(Self.WorkgroupTuningKey), "{:02x}", Byte);
+        }
+        std::format_to(std::back_inserter(Self.WorkgroupTuningKey), "-{}", Self.PhysicalDeviceProperties.driverVersion);
+        Self.WorkgroupSize = Fits(DEFAULT_WORKGROUP_SIZE) ? DEFAULT_WORKGROUP_SIZE : FALLBACK_WORKGROUP_SIZE;
+        Self.WorkgroupTuning = false;
+        Self.WorkgroupTuningProfiler = false;
+        Self.WorkgroupTuningFrame = 0;
+        std::ranges::fill(Self.WorkgroupSlotCandidates, u32(-1));
+
+        if (auto SizeString = env_read_string("KOMPUTE_WORKGROUP_SIZE")) {
+            if (auto Size = ParseSize(*SizeString); Fits(Size)) {
+                Self.WorkgroupSize = Size;
+                std::println(stdout, "[info]: workgroup size {}x{}", Size.width, Size.height);
+                return;
+            }
+            std::println(stderr, "[warning]: workgroup size '{}' is not supported by the device", *SizeString);
+        }
+        auto TuningMode = env_read_string("KOMPUTE_WORKGROUP_TUNING").value_or("");
+        if (TuningMode == "off") {
+            std::println(stdout, "[info]: workgroup size {}x{}", Self.WorkgroupSize.width, Self.WorkgroupSize.height);
+            return;
+        }
+        if (TuningMode != "retune") {
+            auto Saved = file_read_bytes(WORKGROUP_TUNING_PATH).value_or(std::vector<char>());
+            for (auto Line : std::views::split(std::string_view(Saved.data(), Saved.size()), '\n')) {
+                auto Entry = std::string_view(Line.begin(), Line.end());
+                if (Entry.starts_with(Self.WorkgroupTuningKey + " ")) {
+                    if (auto Size = ParseSize(Entry.substr(Self.WorkgroupTuningKey.size() + 1)); Fits(Size)) {
+                        Self.WorkgroupSize = Size;
+                        std::println(stdout, "[info]: workgroup size {}x{}, tuned earlier for this device", Size.width, Size.height);
+                        return;
+                    }
+                }
+            }
+        }
+        // Tuning changes WorkgroupSize under the reload thread (ShaderReloadLoop), so it waits for a run without it.
+        if (Self.ShaderHotReload || !Self.TimestampsSupported) {
+            std::println(stdout, "[info]: workgroup size {}x{}, not tuned ({})", Self.WorkgroupSize.width, Self.WorkgroupSize.height, Self.TimestampsSupported ? "shader hot reload" : "no timestamps");
+            return;
+        }
+
+        for (auto Candidate : WORKGROUP_SIZE_CANDIDATES) {
+            if (Fits(Candidate)) {
+                Self.WorkgroupCandidates.push_back(Candidate);
+            }
+        }
+        Self.WorkgroupCandidateSamples.resize(Self.WorkgroupCandidates.size());
+        Self.WorkgroupTuning = true;
+        Self.WorkgroupTuningProfiler = !Self.GpuProfilerEnabled;
+        Self.GpuProfilerEnabled = true;
+        std::println(stdout, "[info]: tuning the workgroup size over {} candidates", Self.WorkgroupCandidates.size());
+    }
+
+    // Called at the frame boundary before the frame is recorded. Every candidate renders its frames in turn with the
+    // whole image damaged, so each timed dispatch covers all of it; dynamic resolution holds its scale meanwhile, and
+    // samples are nanoseconds per pixel, so a resize in between does not favour a candidate. Frames are read back
+    // FrameSlotCount frames later, which is how long the last candidate keeps rendering untimed before the fastest
+    // median wins.
+    void StepWorkgroupTuning(this VulkanApplication& Self, u32 FrameIndex, u64 RetireValue) {
+        if (!Self.WorkgroupTuning) {
+            return;
+        }
+        u32 FramesPerCandidate = WORKGROUP_TUNING_WARMUP_FRAMES + WORKGROUP_TUNING_SAMPLE_FRAMES;
+        u32 ScheduledFrames = FramesPerCandidate * u32(Self.WorkgroupCandidates.size());
+        if (Self.WorkgroupTuningFrame == 0) {
+            Self.RetiredPipelines.push_back(RetiredPipeline{
+                .Pipeline = Self.ComputePipeline,
+                .RetireValue = RetireValue
+            });
+        }
+        if (Self.WorkgroupTuningFrame < ScheduledFrames + Self.FrameSlotCount) {
+            u32 Candidate = std::min(Self.WorkgroupTuningFrame / FramesPerCandidate, u32(Self.WorkgroupCandidates.size()) - 1);
+            Self.ComputePipeline = Self.WorkgroupCandidatePipelines[Candidate];
+            Self.WorkgroupSize = Self.WorkgroupCandidates[Candidate];
+            bool Timed = Self.WorkgroupTuningFrame < ScheduledFrames && Self.WorkgroupTuningFrame % FramesPerCandidate >= WORKGROUP_TUNING_WARMUP_FRAMES;
+            Self.WorkgroupSlotCandidates[FrameIndex] = Timed ? Candidate : u32(-1);
+            Self.WorkgroupTuningFrame += 1;
+            Self.Damage.DamageAll();
+            return;
+        }
+
+        usize Winner = 0;
+        auto WinnerNanoseconds = std::numeric_limits<f64>::infinity();
+        for (usize i = 0; i < Self.WorkgroupCandidates.size(); i += 1) {
+            auto& Samples = Self.WorkgroupCandidateSamples[i];
+            if (Samples.empty()) {
+                continue;
+            }
+            auto Median = Samples.begin() + isize(Samples.size() / 2);
+            std::ranges::nth_element(Samples, Median);
+            std::println(stdout, "[info]: workgroup {}x{}: median dispatch {:.4f} ns per pixel over {} frames", Self.WorkgroupCandidates[i].width, Self.WorkgroupCandidates[i].height, *Median, Samples.size());
+            if (*Median < WinnerNanoseconds) {
+                Winner = i;
+                WinnerNanoseconds = *Median;
+            }
+        }
+        for (usize i = 0; i < Self.WorkgroupCandidatePipelines.size(); i += 1) {
+            if (i != Winner) {
+                Self.RetiredPipelines.push_back(RetiredPipeline{
+                    .Pipeline = Self.WorkgroupCandidatePipelines[i],
+                    .RetireValue = RetireValue
+                });
+            }
+        }
+        Self.ComputePipeline = Self.WorkgroupCandidatePipelines[Winner];
+        Self.WorkgroupSize = Self.WorkgroupCandidates[Winner];
+        Self.WorkgroupCandidatePipelines.clear();
+        Self.WorkgroupTuning = false;
+        Self.Damage.DamageAll();
+        std::println(stdout, "[info]: workgroup size {}x{} chosen", Self.WorkgroupSize.width, Self.WorkgroupSize.height);
+        Self.SaveWorkgroupSize();
+        // Frames still in flight wrote their timestamps and are read back as usual; later ones record none.
+        if (Self.WorkgroupTuningProfiler) {
+            Self.GpuProfilerEnabled = false;
+        }
+    }
+
+    // One line per device and driver; lines for other devices are kept.
+    void SaveWorkgroupSize(this VulkanApplication& Self) {
+        auto Saved = file_read_bytes(WORKGROUP_TUNING_PATH).value_or(std::vector<char>());
+        auto Contents = std::string();
+        for (auto Line : std::views::split(std::string_view(Saved.data(), Saved.size()), '\n')) {
+            auto Entry = std::string_view(Line.begin(), Line.end());
+            if (!Entry.empty() && !Entry.starts_with(Self.WorkgroupTuningKey + " ")) {
+                std::format_to(std::back_inserter(Contents), "{}\n", Entry);
+            }
+        }
+        std::format_to(std::back_inserter(Contents), "{} {}x{}\n", Self.WorkgroupTuningKey, Self.WorkgroupSize.width, Self.WorkgroupSize.height);
+        if (!file_write_bytes_atomic(WORKGROUP_TUNING_PATH, Contents)) {
+            std::println(stderr, "[warning]: failed to save the workgroup size to {}", WORKGROUP_TUNING_PATH);
+        }
+    }
+
+    // KOMPUTE_DYNAMIC_RESOLUTION=MILLISECONDS renders into a scaled sub-rectangle of ComputeImage, sized so the
+    // frame's GPU time (first scope begin to last scope end) tracks that budget, and the blit upscales it to the
+    // surface. It needs the blit path and per-frame recording.
+    void SelectDynamicResolution(this VulkanApplication& Self) {
+        Self.DynamicResolution = false;
+        Self.RenderScale = RenderScaleController();
+        if (auto BudgetString = env_read_string("KOMPUTE_DYNAMIC_RESOLUTION")) {
+            std::from_chars(BudgetString->data(), BudgetString->data() + BudgetString->size(), Self.RenderScale.BudgetMilliseconds);
+            if (Self.RenderScale.BudgetMilliseconds > 0.0) {
+                Self.DynamicResolution = true;
+                std::println(stdout, "[info]: dynamic resolution with a {:.2f} ms GPU budget", Self.RenderScale.BudgetMilliseconds);
+            } else {
+                std::println(stderr, "[warning]: GPU budget '{}' is not a positive number of milliseconds, dynamic resolution is disabled", *BudgetString);
+            }
+        }
+    }
+
+    // Called before a frame is recorded; every pass of the frame reads the same RenderExtent. A new extent damages
+    // the whole render area.
+    void UpdateRenderExtent(this VulkanApplication& Self) {
+        auto RenderExtent = VkExtent2D{
+            .width = std::max(1u, u32(std::lround(f64(Self.SurfaceCapabilities.currentExtent.width) * Self.RenderScale.Scale))),
+            .height = std::max(1u, u32(std::lround(f64(Self.SurfaceCapabilities.currentExtent.height) * Self.RenderScale.Scale)))
+        };
+        if (Self.Damage.TileVersions.empty()
+         || RenderExtent.width != Self.RenderExtent.width || RenderExtent.height != Self.RenderExtent.height
+         || Self.Damage.TileWidth != Self.WorkgroupSize.width || Self.Damage.TileHeight != Self.WorkgroupSize.height) {
+            Self.RenderExtent = RenderExtent;
+            // One tile per workgroup, so a rectangle of dirty tiles is dispatched with its first tile as the base
+            // workgroup and its size in tiles as the group count.
+            Self.Damage.Reset(RenderExtent.width, RenderExtent.height, Self.WorkgroupSize.width, Self.WorkgroupSize.height);
+        }
+        if (!Self.IncrementalDamage) {
+            Self.Damage.Collect(0, DAMAGE_MAX_RECTS, Self.DispatchRects);
+            Self.Damage.Collect(0, DAMAGE_MAX_RECTS, Self.SurfaceRects);
+            Self.Damage.Collect(0, DAMAGE_MAX_RECTS, Self.PresentRects);
+            Self.BuildDamageRegions();
+        }
+    }
+
+    // Damage tracking redraws only the tiles that changed since an image was last drawn. Images have to keep their
+    // contents from one use to the next for that, which rules out commands prerecorded for whole images, aliased
+    // ComputeImages and async compute, whose ComputeImages change queue family every frame. Swapchain images are not
+    // guaranteed to keep theirs: an acquired image's contents are undefined, so every window frame is blitted or, on
+    // the direct path, dispatched whole, and only the ComputeImages and the headless images, which the application
+    // owns, are redrawn in part. Present regions still report the tiles that changed since the previous present.
+    // KOMPUTE_FULL_REDRAW redraws every frame whole.
+    void SelectDamageTracking(this VulkanApplication& Self) {
+        Self.IncrementalDamage = !Self.PrerecordCommands
+                              && !Self.AliasComputeImages
+                              && !Self.AsyncCompute
+                              && !env_read_string("KOMPUTE_FULL_REDRAW");
+        Self.DispatchSinceVersion = 0;
+        Self.SurfaceSinceVersion = 0;
+        std::println(stdout, "[info]: damage tracking: {}{}", Self.IncrementalDamage ? "dirty tiles" : "full redraw", Self.IncrementalDamage && Self.IncrementalPresentEnabled ? ", incremental present" : "");
+    }
+
+    // Collects the tiles the compute output and the swapchain image of this frame each missed since they were last
+    // drawn, where version 0 stands for an image that has to be drawn whole, and the tiles that changed since the
+    // previous present. Once the frame is recorded both images are up to date.
+    void PrepareFrameDamage(this VulkanApplication& Self, u32 FrameIndex, u32 ImageIndex) {
+        if (!Self.IncrementalDamage) {
+            return;
+        }
+        Self.SurfaceSinceVersion = Self.Headless ? std::exchange(Self.SurfaceImageVersions[ImageIndex], Self.Damage.Version) : 0;
+        Self.Damage.Collect(Self.SurfaceSinceVersion, DAMAGE_MAX_RECTS, Self.SurfaceRects);
+        if (Self.DirectSwapchainOutput) {
+            Self.DispatchSinceVersion = Self.SurfaceSinceVersion;
+            Self.DispatchRects = Self.SurfaceRects;
+        } else {
+            Self.DispatchSinceVersion = std::exchange(Self.ComputeImageVersions[FrameIndex], Self.Damage.Version);
+            Self.Damage.Collect(Self.DispatchSinceVersion, DAMAGE_MAX_RECTS, Self.DispatchRects);
+        }
+        Self.Damage.Collect(std::exchange(Self.PresentedVersion, Self.Damage.Version), DAMAGE_MAX_RECTS, Self.PresentRects);
+        Self.BuildDamageRegions();
+    }
+
+    // Turns SurfaceRects into blit regions and PresentRects into present rectangles, both in swapchain image pixels. A
+    // scaled render area is blitted and presented whole whenever any of it changed, since filtering spreads every tile
+    // into its neighbours.
+    void BuildDamageRegions(this VulkanApplication& Self) {
+        auto SurfaceExtent = Self.SurfaceCapabilities.currentExtent;
+        bool Scaled = Self.RenderExtent.width != SurfaceExtent.width || Self.RenderExtent.height != SurfaceExtent.height;
+        // Calls Add with the source and destination pixels of each rectangle.
+        auto ForEachRegion = [&](std::vector<TileRect> const& Rects, auto&& Add) {
+            if (Scaled) {
+                if (!Rects.empty()) {
+                    Add(VkOffset2D{0, 0}, Self.RenderExtent, VkOffset2D{0, 0}, SurfaceExtent);
+                }
+                return;
+            }
+            for (auto const& Rect : Rects) {
+                auto Offset = VkOffset2D{
+                    .x = i32(Rect.X * Self.Damage.TileWidth),
+                    .y = i32(Rect.Y * Self.Damage.TileHeight)
+                };
+                auto Extent = VkExtent2D{
+                    .width = std::min(Rect.Width * Self.Damage.TileWidth, SurfaceExtent.width - u32(Offset.x)),
+                    .height = std::min(Rect.Height * Self.Damage.TileHeight, SurfaceExtent.height - u32(Offset.y))
+                };
+                Add(Offset, Extent, Offset, Extent);
+            }
+        };
+        Self.BlitRegions.clear();
+        ForEachRegion(Self.SurfaceRects, [&](VkOffset2D SourceOffset, VkExtent2D SourceExtent, VkOffset2D Offset, VkExtent2D Extent) {
+            Self.BlitRegions.push_back(VkImageBlit2{
+                .sType = VK_STRUCTURE_TYPE_IMAGE_BLIT_2,
+                .pNext = {},
+                .srcSubresource = VkImageSubresourceLayers{
+                    .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                    .mipLevel = 0,
+                    .baseArrayLayer = 0,
+                    .layerCount = 1
+                },
+                .srcOffsets = {
+                    VkOffset3D{
+                        .x = SourceOffset.x,
+                        .y = SourceOffset.y,
+                        .z = 0
+                    },
+                    VkOffset3D{
+                        .x = SourceOffset.x + i32(SourceExtent.width),
+                        .y = SourceOffset.y + i32(SourceExtent.height),
+                        .z = 1
+                    },
+                },
+                .dstSubresource = VkImageSubresourceLayers{
+                    .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                    .mipLevel = 0,
+                    .baseArrayLayer = 0,
+                    .layerCount = 1
+                },
+                .dstOffsets = {
+                    VkOffset3D{
+                        .x = Offset.x,
+                        .y = Offset.y,
+                        .z = 0
+                    },
+                    VkOffset3D{
+                        .x = Offset.x + i32(Extent.width),
+                        .y = Offset.y + i32(Extent.height),
+                        .z = 1
+                    },
+                }
+            });
+        });
+        Self.PresentRectangles.clear();
+        ForEachRegion(Self.PresentRects, [&](VkOffset2D, VkExtent2D, VkOffset2D Offset, VkExtent2D Extent) {
+            Self.PresentRectangles.push_back(VkRectLayerKHR{
+                .offset = Offset,
+                .extent = Extent,
+                .layer = 0
+            });
+        });
+        // Frames keep presenting while nothing changes, so the frame timings, latency samples and GPU scopes go on; only
+        // on-demand rendering stops the loop. No rectangles at all would mean the whole image changed, so an unchanged
+        // frame reports a single pixel.
+        if (Self.PresentRectangles.empty()) {
+            Self.PresentRectangles.push_back(VkRectLayerKHR{
+                .offset = VkOffset2D{0, 0},
+                .extent = VkExtent2D{1, 1},
+                .layer = 0
+            });
+        }
+    }
+
+    void CreateDeviceObjects(this VulkanApplication& Self) {
+        Self.Fences = new VkFence[Self.FrameSlotCount];
+        Self.SubmitSemaphores = new VkSemaphore[Self.FrameSlotCount];
+        Self.AcquireSemaphores = new VkSemaphore[Self.FrameSlotCount];
+        Self.CommandPools = new VkCommandPool[Self.FrameSlotCount];
+        Self.CommandBuffers = new VkCommandBuffer[Self.FrameSlotCount];
+        Self.DeviceDispatcher->vkCreateSemaphore(
+            Self.LogicalDevice,
+            (VkSemaphoreCreateInfo[]){{
+                .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+                .pNext = (VkSemaphoreTypeCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+                    .pNext = {},
+                    .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+                    .initialValue = 0
+                }}
+            }},
+            nullptr,
+            &Self.TimelineSemaphore
+        );
+        for (u32 i = 0; i < Self.FrameSlotCount; i += 1) {
+            Self.DeviceDispatcher->vkCreateFence(
+                Self.LogicalDevice,
+                (VkFenceCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+                    .flags = {},
+                }},
+                nullptr,
+                &Self.Fences[i]
+            );
+            Self.DeviceDispatcher->vkCreateSemaphore(
+                Self.LogicalDevice,
+                (VkSemaphoreCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+                    .pNext = (VkSemaphoreTypeCreateInfo[]){{
+                        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+                        .pNext = {},
+                        .semaphoreType = VK_SEMAPHORE_TYPE_BINARY,
+                    }}
+                }},
+                nullptr,
+                &Self.SubmitSemaphores[i]
+            );
+            Self.DeviceDispatcher->vkCreateSemaphore(
+                Self.LogicalDevice,
+                (VkSemaphoreCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+                    .pNext = (VkSemaphoreTypeCreateInfo[]){{
+                        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+                        .pNext = {},
+                        .semaphoreType = VK_SEMAPHORE_TYPE_BINARY,
+                    }}
+                }},
+                nullptr,
+                &Self.AcquireSemaphores[i]
+            );
+            Self.DeviceDispatcher->vkCreateCommandPool(
+                Self.LogicalDevice,
+                (VkCommandPoolCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                    .pNext = {},
+                    .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+                    .queueFamilyIndex = Self.QueueFamilyIndex
+                }},
+                nullptr,
+                &Self.CommandPools[i]
+            );
+            Self.DeviceDispatcher->vkAllocateCommandBuffers(
+                Self.LogicalDevice,
+                (VkCommandBufferAllocateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                    .commandPool = Self.CommandPools[i],
+                    .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                    .commandBufferCount = 1,
+                }},
+                &Self.CommandBuffers[i]
+            );
+        }
+
+        // Async compute records the dispatch into per-slot buffers of the compute family and hands each frame over
+        // to the main queue through ComputeTimelineSemaphore, which frame N signals with N + 1.
+        if (!Self.AsyncCompute) {
+            return;
+        }
+        Self.ComputeCommandPools = new VkCommandPool[Self.FrameSlotCount];
+        Self.ComputeCommandBuffers = new VkCommandBuffer[Self.FrameSlotCount];
+        Self.DeviceDispatcher->vkCreateSemaphore(
+            Self.LogicalDevice,
+            (VkSemaphoreCreateInfo[]){{
+                .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+                .pNext = (VkSemaphoreTypeCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+                    .pNext = {},
+                    .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+                    .initialValue = 0
+                }}
+            }},
+            nullptr,
+            &Self.ComputeTimelineSemaphore
+        );
+        for (u32 i = 0; i < Self.FrameSlotCount; i += 1) {
+            Self.DeviceDispatcher->vkCreateCommandPool(
+                Self.LogicalDevice,
+                (VkCommandPoolCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                    .pNext = {},
+                    .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+                    .queueFamilyIndex = Self.ComputeQueueFamilyIndex
+                }},
+                nullptr,
+                &Self.ComputeCommandPools[i]
+            );
+            Self.DeviceDispatcher->vkAllocateCommandBuffers(
+                Self.LogicalDevice,
+                (VkCommandBufferAllocateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                    .commandPool = Self.ComputeCommandPools[i],
+                    .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                    .commandBufferCount = 1,
+                }},
+                &Self.ComputeCommandBuffers[i]
+            );
+        }
+    }
+
+    void DeleteDeviceObjects(this VulkanApplication& Self) {
+        for (u32 i = 0; i < Self.FrameSlotCount; i += 1) {
+            Self.DeviceDispatcher->vkDestroyFence(Self.LogicalDevice, Self.Fences[i], nullptr);
+            Self.DeviceDispatcher->vkDestroyCommandPool(Self.LogicalDevice, Self.CommandPools[i], nullptr);
+            Self.DeviceDispatcher->vkDestroySemaphore(Self.LogicalDevice, Self.SubmitSemaphores[i], nullptr);
+            Self.DeviceDispatcher->vkDestroySemaphore(Self.LogicalDevice, Self.AcquireSemaphores[i], nullptr);
+        }
+        Self.DeviceDispatcher->vkDestroySemaphore(Self.LogicalDevice, Self.TimelineSemaphore, nullptr);
+        delete[] Self.Fences;
+        delete[] Self.CommandPools;
+        delete[] Self.CommandBuffers;
+        delete[] Self.SubmitSemaphores;
+        delete[] Self.AcquireSemaphores;
+
+        if (!Self.AsyncCompute) {
+            return;
+        }
+        for (u32 i = 0; i < Self.FrameSlotCount; i += 1) {
+            Self.DeviceDispatcher->vkDestroyCommandPool(Self.LogicalDevice, Self.ComputeCommandPools[i], nullptr);
+        }
+        Self.DeviceDispatcher->vkDestroySemaphore(Self.LogicalDevice, Self.ComputeTimelineSemaphore, nullptr);
+        delete[] Self.ComputeCommandPools;
+        delete[] Self.ComputeCommandBuffers;
+    }
+
+    void CreateVulkanShaders(this VulkanApplication& Self) {
+        auto ComputeShaderBytes = file_read_bytes(Self.ComputeShaderBinary).value();
+
+        Self.DeviceDispatcher->vkCreateDescriptorSetLayout(
+            Self.LogicalDevice,
+            (VkDescriptorSetLayoutCreateInfo[]){{
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+                .pNext = {},
+                .flags = Self.ComputeDescriptorStrategy == DescriptorStrategy::Push ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR
+                       : Self.ComputeDescriptorStrategy == DescriptorStrategy::Buffer ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT
+                       : VkDescriptorSetLayoutCreateFlags(),
+                .bindingCount = 1,
                 .pBindings = (VkDescriptorSetLayoutBinding[]){
                     VkDescriptorSetLayoutBinding{
                         .binding = 0,
@@ -366,33 +1559,67 @@ struct VulkanApplication {
                 .pSetLayouts = (VkDescriptorSetLayout[]){
                     Self.ComputeDescriptorSetLayout
                 },
+                .pushConstantRangeCount = 1,
+                .pPushConstantRanges = (VkPushConstantRange[]){
+                    VkPushConstantRange{
+                        .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+                        .offset = 0,
+                        .size = sizeof(VkExtent2D)
+                    }
+                }
             }},
             nullptr,
             &Self.ComputePipelineLayout
         );
 
+        Self.ComputePipeline = Self.CreateComputePipeline(ComputeShaderBytes, Self.WorkgroupSize);
+        if (Self.ComputePipeline == VK_NULL_HANDLE) {
+            std::println(stderr, "[error]: failed to create the compute pipeline from {}", Self.ComputeShaderBinary);
+            std::abort();
+        }
+        for (auto Candidate : Self.WorkgroupCandidates) {
+            Self.WorkgroupCandidatePipelines.push_back(Self.CreateComputePipeline(ComputeShaderBytes, Candidate));
+        }
+    }
+
+    // Builds the compute pipeline from SPIR-V. Safe to call from any thread once the pipeline layout exists; returns
+    // VK_NULL_HANDLE if the code is not SPIR-V or the driver rejects it.
+    auto CreateComputePipeline(this VulkanApplication& Self, std::span<char const> ShaderBytes, VkExtent2D WorkgroupSize) -> VkPipeline {
+        u32 SpirvMagic = 0;
+        if (ShaderBytes.size() >= sizeof(u32)) {
+            std::memcpy(&SpirvMagic, ShaderBytes.data(), sizeof(u32));
+        }
+        if (SpirvMagic != 0x07230203 || ShaderBytes.size() % sizeof(u32) != 0) {
+            return VK_NULL_HANDLE;
+        }
+
         VkShaderModule ComputeShaderModule;
-        Self.DeviceDispatcher->vkCreateShaderModule(
+        auto ModuleResult = Self.DeviceDispatcher->vkCreateShaderModule(
             Self.LogicalDevice,
             (VkShaderModuleCreateInfo[]){{
                 .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
                 .pNext = {},
                 .flags = {},
-                .codeSize = ComputeShaderBytes.size(),
-                .pCode = std::bit_cast<u32 const*>(ComputeShaderBytes.data()),
+                .codeSize = ShaderBytes.size(),
+                .pCode = std::bit_cast<u32 const*>(ShaderBytes.data()),
             }},
             nullptr,
             &ComputeShaderModule
         );
+        if (ModuleResult != VK_SUCCESS) {
+            return VK_NULL_HANDLE;
+        }
 
-        Self.DeviceDispatcher->vkCreateComputePipelines(
+        auto PipelineCreateStart = std::chrono::steady_clock::now();
+        auto ComputePipeline = VkPipeline();
+        auto PipelineResult = Self.DeviceDispatcher->vkCreateComputePipelines(
             Self.LogicalDevice,
-            nullptr,
+            Self.PipelineCache,
             1,
             (VkComputePipelineCreateInfo[]) {{
                 .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
                 .pNext = {},
-                .flags = VK_PIPELINE_CREATE_DISPATCH_BASE_BIT,
+                .flags = VK_PIPELINE_CREATE_DISPATCH_BASE_BIT | (Self.ComputeDescriptorStrategy == DescriptorStrategy::Buffer ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : VkPipelineCreateFlags()),
                 .stage = VkPipelineShaderStageCreateInfo{
                     .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
                     .pNext = {},
@@ -408,7 +1635,7 @@ struct VulkanApplication {
                             VkSpecializationMapEntry(2, 8, sizeof(u32)),
                         },
                         .dataSize = sizeof(u32[3]),
-                        .pData = (u32[]){32, 32, 1}
+                        .pData = (u32[]){WorkgroupSize.width, WorkgroupSize.height, 1}
                     }},
                 },
                 .layout = Self.ComputePipelineLayout,
@@ -416,61 +1643,420 @@ struct VulkanApplication {
                 .basePipelineIndex = {}
             }},
             nullptr,
-            &Self.ComputePipeline
+            &ComputePipeline
         );
         Self.DeviceDispatcher->vkDestroyShaderModule(Self.LogicalDevice, ComputeShaderModule, nullptr);
+        if (PipelineResult != VK_SUCCESS) {
+            return VK_NULL_HANDLE;
+        }
+        std::println(stdout, "[info]: compute pipeline ({}x{}) created in {:.2f} ms", WorkgroupSize.width, WorkgroupSize.height, std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - PipelineCreateStart).count());
+        return ComputePipeline;
     }
 
-    void DeleteVulkanShaders(this VulkanApplication& Self) {
-        Self.DeviceDispatcher->vkDestroyPipeline(Self.LogicalDevice, Self.ComputePipeline, nullptr);
-        Self.DeviceDispatcher->vkDestroyPipelineLayout(Self.LogicalDevice, Self.ComputePipelineLayout, nullptr);
-        Self.DeviceDispatcher->vkDestroyDescriptorSetLayout(Self.LogicalDevice, Self.ComputeDescriptorSetLayout, nullptr);
+    // Starts watching SHADER_DIRECTORY for KOMPUTE_SHADER_HOT_RELOAD ahead of the workgroup size, which must not
+    // change while the reload thread builds pipelines; CreateShaderReloader starts that thread once the pipeline
+    // layout exists.
+    void SelectShaderHotReload(this VulkanApplication& Self) {
+        Self.ShaderHotReload = false;
+        if (!env_read_string("KOMPUTE_SHADER_HOT_RELOAD")) {
+            return;
+        }
+        if (!Self.ShaderWatcher.Start(SHADER_DIRECTORY)) {
+            std::println(stderr, "[warning]: cannot watch {}, shader hot reload is disabled", SHADER_DIRECTORY);
+            return;
+        }
+        Self.ShaderHotReload = true;
     }
 
-    void CreateVulkanTextures(this VulkanApplication& Self) {
-        Self.InstanceDispatcher->vkGetPhysicalDeviceSurfaceCapabilitiesKHR(Self.PhysicalDevice, Self.Surface, &Self.SurfaceCapabilities);
-        Self.DeviceDispatcher->vkCreateSwapchainKHR(
-            Self.LogicalDevice,
-            (VkSwapchainCreateInfoKHR[]){{
-                .sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
-                .pNext = {},
-                .flags = {},
-                .surface = Self.Surface,
-                .minImageCount = 3,
-                .imageFormat = VK_FORMAT_B8G8R8A8_UNORM,
-                .imageColorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
-                .imageExtent = Self.SurfaceCapabilities.currentExtent,
-                .imageArrayLayers = 1,
-                .imageUsage = Self.SurfaceCapabilities.supportedUsageFlags,
-                .imageSharingMode = VK_SHARING_MODE_EXCLUSIVE,
-                .queueFamilyIndexCount = 0,
-                .pQueueFamilyIndices = {},
-                .preTransform = Self.SurfaceCapabilities.currentTransform,
-                .compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
-                .presentMode = VK_PRESENT_MODE_FIFO_KHR,
-                .clipped = VK_FALSE,
-                .oldSwapchain = {},
-            }},
-            nullptr,
-            &Self.Swapchain
-        );
-        Self.DeviceDispatcher->vkGetSwapchainImagesKHR(Self.LogicalDevice, Self.Swapchain, &Self.SurfaceImageCount, nullptr);
-        Self.SurfaceImages = new VkImage[Self.SurfaceImageCount];
-        Self.DeviceDispatcher->vkGetSwapchainImagesKHR(Self.LogicalDevice, Self.Swapchain, &Self.SurfaceImageCount, Self.SurfaceImages);
+    // KOMPUTE_SHADER_HOT_RELOAD watches SHADER_DIRECTORY: a changed ps.comp is compiled with the build's glslc into
+    // ComputeShaderBinary, the file the build writes next to the source and the application loads at startup, and
+    // a changed binary is built into a new pipeline on the watcher thread. The render thread swaps it in at
+    // the next frame boundary and retires the old one once the timeline passes the frames that used it, so it never
+    // waits on a compile.
+    void CreateShaderReloader(this VulkanApplication& Self) {
+        Self.ShaderReloadStopping.store(false);
+        Self.PendingComputePipeline.store(VK_NULL_HANDLE);
+        Self.PipelineReadyEvent = u32(-1);
+        if (!Self.ShaderHotReload) {
+            return;
+        }
+        // Wakes the render thread through the event pump when it sleeps on demand.
+        if (!Self.Headless) {
+            Self.PipelineReadyEvent = SDL_RegisterEvents(1);
+        }
+        Self.ShaderReloadThread = std::thread([&Self] {
+            Self.ShaderReloadLoop();
+        });
+        std::println(stdout, "[info]: watching {} for shader changes", SHADER_DIRECTORY);
+    }
 
-        Self.SurfaceImageViews = new VkImageView[Self.SurfaceImageCount];
-        for (u32 i = 0; i < Self.SurfaceImageCount; i += 1) {
-            Self.DeviceDispatcher->vkCreateImageView(
-                Self.LogicalDevice,
-                (VkImageViewCreateInfo[]){{
-                    .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
-                    .pNext = {},
-                    .flags = {},
-                    .image = Self.SurfaceImages[i],
-                    .viewType = VK_IMAGE_VIEW_TYPE_2D,
-                    .format = VK_FORMAT_B8G8R8A8_UNORM,
-                    .components = VkComponentMapping{
-                        .r = VK_COMPONENT_SWIZZLE_R,
+    void DeleteShaderReloader(this VulkanApplication& Self) {
+        if (!Self.ShaderHotReload) {
+            return;
+        }
+        Self.ShaderReloadStopping.store(true);
+        Self.ShaderReloadThread.join();
+        Self.ShaderWatcher.Stop();
+        if (auto Pipeline = Self.PendingComputePipeline.exchange(VK_NULL_HANDLE); Pipeline != VK_NULL_HANDLE) {
+            Self.DeviceDispatcher->vkDestroyPipeline(Self.LogicalDevice, Pipeline, nullptr);
+        }
+    }
+
+    void ShaderReloadLoop(this VulkanApplication& Self) {
+        auto SourceName = std::filesystem::path(COMPUTE_SHADER_SOURCE).filename().string();
+        auto BinaryName = std::filesystem::path(Self.ComputeShaderBinary).filename().string();
+        auto ChangedNames = std::vector<std::string>();
+        while (!Self.ShaderReloadStopping.load()) {
+            ChangedNames.clear();
+            Self.ShaderWatcher.Wait(SHADER_WATCH_TIMEOUT_MILLISECONDS, ChangedNames);
+            // The compiled binary comes back as an event of its own.
+            if (std::ranges::contains(ChangedNames, SourceName)) {
+                std::println(stdout, "[info]: {} changed, compiling", COMPUTE_SHADER_SOURCE);
+                auto Command = std::format("\"{}\" {} \"{}\" -o \"{}\"", GLSLC_EXECUTABLE, Self.StorageWriteWithoutFormat ? "" : COMPUTE_SHADER_FORMAT_DEFINE, COMPUTE_SHADER_SOURCE, Self.ComputeShaderBinary);
+                if (std::system(Command.c_str()) != 0) {
+                    std::println(stderr, "[warning]: compiling {} failed, keeping the current pipeline", COMPUTE_SHADER_SOURCE);
+                }
+                continue;
+            }
+            if (!std::ranges::contains(ChangedNames, BinaryName)) {
+                continue;
+            }
+            auto ShaderBytes = file_read_bytes(Self.ComputeShaderBinary);
+            // WorkgroupSize belongs to the render thread, but it only changes while tuning, and SelectWorkgroupSize
+            // never tunes with hot reload on, so it is fixed by the time this thread runs.
+            auto Pipeline = ShaderBytes ? Self.CreateComputePipeline(*ShaderBytes, Self.WorkgroupSize) : VK_NULL_HANDLE;
+            if (Pipeline == VK_NULL_HANDLE) {
+                std::println(stderr, "[warning]: {} does not build a pipeline, keeping the current one", Self.ComputeShaderBinary);
+                continue;
+            }
+            // A pipeline still waiting for the render thread was never used, so a newer one replaces it outright.
+            if (auto Unused = Self.PendingComputePipeline.exchange(Pipeline); Unused != VK_NULL_HANDLE) {
+                Self.DeviceDispatcher->vkDestroyPipeline(Self.LogicalDevice, Unused, nullptr);
+            }
+            if (Self.PipelineReadyEvent != u32(-1)) {
+                auto Event = SDL_Event{.type = Self.PipelineReadyEvent};
+                SDL_PushEvent(&Event);
+            }
+        }
+    }
+
+    // Called at a frame boundary on the render thread; frames submitted up to timeline value RetireValue keep the
+    // old pipeline.
+    void SwapPendingPipeline(this VulkanApplication& Self, u64 RetireValue) {
+        auto Pipeline = Self.PendingComputePipeline.exchange(VK_NULL_HANDLE);
+        if (Pipeline == VK_NULL_HANDLE) {
+            return;
+        }
+        Self.RetiredPipelines.push_back(RetiredPipeline{
+            .Pipeline = Self.ComputePipeline,
+            .RetireValue = RetireValue
+        });
+        Self.ComputePipeline = Pipeline;
+        Self.Damage.DamageAll();
+        std::println(stdout, "[info]: compute pipeline reloaded");
+    }
+
+    void DeleteRetiredPipelines(this VulkanApplication& Self, u64 CompletedValue) {
+        std::erase_if(Self.RetiredPipelines, [&](RetiredPipeline const& Retired) {
+            if (Retired.RetireValue > CompletedValue) {
+                return false;
+            }
+            Self.DeviceDispatcher->vkDestroyPipeline(Self.LogicalDevice, Retired.Pipeline, nullptr);
+            return true;
+        });
+    }
+
+    // KOMPUTE_PIPELINE_CACHE=PATH moves the on-disk pipeline cache from PIPELINE_CACHE_DEFAULT_PATH, an empty PATH
+    // turns it off. A file built for another device or driver is ignored and replaced at shutdown.
+    void CreatePipelineCache(this VulkanApplication& Self) {
+        Self.PipelineCachePath = env_read_string("KOMPUTE_PIPELINE_CACHE").value_or(PIPELINE_CACHE_DEFAULT_PATH);
+        Self.PipelineCache = VK_NULL_HANDLE;
+        if (Self.PipelineCachePath.empty()) {
+            return;
+        }
+
+        auto Bytes = file_read_bytes(Self.PipelineCachePath);
+        auto InitialData = Bytes ? Self.ValidPipelineCacheData(*Bytes) : std::span<char const>();
+        if (Bytes && InitialData.empty()) {
+            std::println(stdout, "[info]: pipeline cache {} is for another device or driver, starting empty", Self.PipelineCachePath);
+        } else if (Bytes) {
+            std::println(stdout, "[info]: pipeline cache {} loaded, {} KiB", Self.PipelineCachePath, InitialData.size() / 1024);
+        }
+        Self.DeviceDispatcher->vkCreatePipelineCache(
+            Self.LogicalDevice,
+            (VkPipelineCacheCreateInfo[]){{
+                .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+                .pNext = {},
+                .flags = {},
+                .initialDataSize = InitialData.size(),
+                .pInitialData = InitialData.data()
+            }},
+            nullptr,
+            &Self.PipelineCache
+        );
+    }
+
+    void DeletePipelineCache(this VulkanApplication& Self) {
+        if (Self.PipelineCache == VK_NULL_HANDLE) {
+            return;
+        }
+        Self.SavePipelineCache();
+        Self.DeviceDispatcher->vkDestroyPipelineCache(Self.LogicalDevice, Self.PipelineCache, nullptr);
+    }
+
+    // Processes sharing the file each merge in what is on disk before writing, and the write replaces the file in one
+    // rename, so readers never see a partial cache. Two processes saving at the same moment can still drop each
+    // other's new pipelines, which only costs a compile on the next launch.
+    void SavePipelineCache(this VulkanApplication& Self) {
+        if (auto Bytes = file_read_bytes(Self.PipelineCachePath)) {
+            if (auto DiskData = Self.ValidPipelineCacheData(*Bytes); !DiskData.empty()) {
+                VkPipelineCache DiskCache;
+                Self.DeviceDispatcher->vkCreatePipelineCache(
+                    Self.LogicalDevice,
+                    (VkPipelineCacheCreateInfo[]){{
+                        .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+                        .pNext = {},
+                        .flags = {},
+                        .initialDataSize = DiskData.size(),
+                        .pInitialData = DiskData.data()
+                    }},
+                    nullptr,
+                    &DiskCache
+                );
+                Self.DeviceDispatcher->vkMergePipelineCaches(Self.LogicalDevice, Self.PipelineCache, 1, &DiskCache);
+                Self.DeviceDispatcher->vkDestroyPipelineCache(Self.LogicalDevice, DiskCache, nullptr);
+            }
+        }
+
+        usize DataSize;
+        Self.DeviceDispatcher->vkGetPipelineCacheData(Self.LogicalDevice, Self.PipelineCache, &DataSize, nullptr);
+        auto Bytes = std::vector<char>(sizeof(PipelineCacheFileHeader) + DataSize);
+        Self.DeviceDispatcher->vkGetPipelineCacheData(Self.LogicalDevice, Self.PipelineCache, &DataSize, Bytes.data() + sizeof(PipelineCacheFileHeader));
+        Bytes.resize(sizeof(PipelineCacheFileHeader) + DataSize);
+        auto Header = PipelineCacheFileHeader{
+            .Magic = PIPELINE_CACHE_FILE_MAGIC,
+            .DriverVersion = Self.PhysicalDeviceProperties.driverVersion,
+            .DataSize = DataSize
+        };
+        std::memcpy(Bytes.data(), &Header, sizeof(Header));
+        if (file_write_bytes_atomic(Self.PipelineCachePath, Bytes)) {
+            std::println(stdout, "[info]: pipeline cache {} saved, {} KiB", Self.PipelineCachePath, DataSize / 1024);
+        } else {
+            std::println(stderr, "[warning]: failed to save pipeline cache {}", Self.PipelineCachePath);
+        }
+    }
+
+    // The Vulkan cache data of a pipeline cache file, or nothing if the file is truncated or was written for another
+    // device, driver or cache layout.
+    auto ValidPipelineCacheData(this VulkanApplication& Self, std::vector<char> const& Bytes) -> std::span<char const> {
+        if (Bytes.size() < sizeof(PipelineCacheFileHeader) + sizeof(VkPipelineCacheHeaderVersionOne)) {
+            return {};
+        }
+        PipelineCacheFileHeader FileHeader;
+        std::memcpy(&FileHeader, Bytes.data(), sizeof(FileHeader));
+        VkPipelineCacheHeaderVersionOne CacheHeader;
+        std::memcpy(&CacheHeader, Bytes.data() + sizeof(FileHeader), sizeof(CacheHeader));
+        bool Valid = FileHeader.Magic == PIPELINE_CACHE_FILE_MAGIC
+                  && FileHeader.DataSize == Bytes.size() - sizeof(FileHeader)
+                  && FileHeader.DriverVersion == Self.PhysicalDeviceProperties.driverVersion
+                  && CacheHeader.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+                  && CacheHeader.vendorID == Self.PhysicalDeviceProperties.vendorID
+                  && CacheHeader.deviceID == Self.PhysicalDeviceProperties.deviceID
+                  && std::ranges::equal(CacheHeader.pipelineCacheUUID, Self.PhysicalDeviceProperties.pipelineCacheUUID);
+        return Valid ? std::span(Bytes).subspan(sizeof(FileHeader)) : std::span<char const>();
+    }
+
+    void DeleteVulkanShaders(this VulkanApplication& Self) {
+        for (auto Pipeline : Self.WorkgroupCandidatePipelines) {
+            if (Pipeline != Self.ComputePipeline) {
+                Self.DeviceDispatcher->vkDestroyPipeline(Self.LogicalDevice, Pipeline, nullptr);
+            }
+        }
+        Self.DeviceDispatcher->vkDestroyPipeline(Self.LogicalDevice, Self.ComputePipeline, nullptr);
+        Self.DeviceDispatcher->vkDestroyPipelineLayout(Self.LogicalDevice, Self.ComputePipelineLayout, nullptr);
+        Self.DeviceDispatcher->vkDestroyDescriptorSetLayout(Self.LogicalDevice, Self.ComputeDescriptorSetLayout, nullptr);
+    }
+
+    // Some platforms leave the extent to the swapchain (0xFFFFFFFF); use the drawable size of the window there.
+    void UpdateSurfaceCapabilities(this VulkanApplication& Self) {
+        if (Self.Headless) {
+            Self.SurfaceCapabilities.currentExtent = Self.HeadlessExtent;
+            return;
+        }
+        Self.InstanceDispatcher->vkGetPhysicalDeviceSurfaceCapabilitiesKHR(Self.PhysicalDevice, Self.Surface, &Self.SurfaceCapabilities);
+        // The drawable size comes from the resize events, since SDL is only called on the main thread.
+        if (Self.SurfaceCapabilities.currentExtent.width == std::numeric_limits<u32>::max()) {
+            Self.SurfaceCapabilities.currentExtent = VkExtent2D{
+                .width = std::clamp(Self.DrawableExtent.width, Self.SurfaceCapabilities.minImageExtent.width, Self.SurfaceCapabilities.maxImageExtent.width),
+                .height = std::clamp(Self.DrawableExtent.height, Self.SurfaceCapabilities.minImageExtent.height, Self.SurfaceCapabilities.maxImageExtent.height)
+            };
+        }
+    }
+
+    // KOMPUTE_PRESENT_MODE picks fifo, fifo_relaxed, mailbox or immediate and KOMPUTE_SWAPCHAIN_IMAGES the minimum image
+    // count. KOMPUTE_LOW_LATENCY paces the loop to one frame: it blocks until the previous frame is on screen (or at
+    // least finished on the GPU without present wait) before sampling input and recording the next one.
+    void SelectPresentMode(this VulkanApplication& Self) {
+        // Headless frames never wait on a display, so there is nothing to pace.
+        if (Self.Headless) {
+            Self.SurfaceMinImageCount = Self.FrameSlotCount;
+            Self.LowLatencyPacing = false;
+            return;
+        }
+        u32 SurfacePresentModeCount;
+        Self.InstanceDispatcher->vkGetPhysicalDeviceSurfacePresentModesKHR(Self.PhysicalDevice, Self.Surface, &SurfacePresentModeCount, nullptr);
+        auto SurfacePresentModes = std::vector<VkPresentModeKHR>(SurfacePresentModeCount);
+        Self.InstanceDispatcher->vkGetPhysicalDeviceSurfacePresentModesKHR(Self.PhysicalDevice, Self.Surface, &SurfacePresentModeCount, SurfacePresentModes.data());
+
+        Self.PresentMode = VK_PRESENT_MODE_FIFO_KHR;
+        if (auto PresentModeName = env_read_string("KOMPUTE_PRESENT_MODE")) {
+            auto PresentMode = VkPresentModeKHR(std::ranges::find(PRESENT_MODE_NAMES, *PresentModeName) - std::begin(PRESENT_MODE_NAMES));
+            if (std::ranges::contains(SurfacePresentModes, PresentMode)) {
+                Self.PresentMode = PresentMode;
+            } else {
+                std::println(stderr, "[warning]: present mode '{}' is not supported, using fifo", *PresentModeName);
+            }
+        }
+
+        u32 MaxImageCount = Self.SurfaceCapabilities.maxImageCount != 0 ? Self.SurfaceCapabilities.maxImageCount : std::numeric_limits<u32>::max();
+        Self.SurfaceMinImageCount = std::clamp(3u, Self.SurfaceCapabilities.minImageCount, MaxImageCount);
+        if (auto ImageCountString = env_read_string("KOMPUTE_SWAPCHAIN_IMAGES")) {
+            u32 ImageCount = 0;
+            std::from_chars(ImageCountString->data(), ImageCountString->data() + ImageCountString->size(), ImageCount);
+            if (ImageCount >= Self.SurfaceCapabilities.minImageCount && ImageCount <= MaxImageCount) {
+                Self.SurfaceMinImageCount = ImageCount;
+            } else {
+                std::println(stderr, "[warning]: swapchain image count '{}' is outside [{}, {}], using {}", *ImageCountString, Self.SurfaceCapabilities.minImageCount, MaxImageCount, Self.SurfaceMinImageCount);
+            }
+        }
+
+        Self.LowLatencyPacing = env_read_string("KOMPUTE_LOW_LATENCY").has_value();
+        std::println(stdout, "[info]: present mode: {}, {} images, {} pacing{}", PRESENT_MODE_NAMES[Self.PresentMode], Self.SurfaceMinImageCount, Self.LowLatencyPacing ? "low-latency" : "throughput", Self.LowLatencyPacing && !Self.PresentWaitEnabled ? " (no present wait, pacing on the GPU timeline)" : "");
+    }
+
+    // The compute shader writes straight into the swapchain image when the surface and its format allow storage
+    // usage and the shader can write that format: any format with shaderStorageImageWriteWithoutFormat, otherwise
+    // only the RGBA headless images the rgba8 shader declares. Otherwise it writes the frame slot's ComputeImage,
+    // which is blitted to the swapchain image. KOMPUTE_BLIT_OUTPUT forces the blit path for comparison, and
+    // KOMPUTE_ALIAS_COMPUTE_IMAGES binds every ComputeImage to the same memory, trading frame overlap for a single
+    // image's footprint. Async compute always takes the blit path, since the hand-over between queues is the
+    // ComputeImage.
+    void SelectOutputPath(this VulkanApplication& Self) {
+        VkFormatProperties SurfaceFormatProperties;
+        Self.InstanceDispatcher->vkGetPhysicalDeviceFormatProperties(Self.PhysicalDevice, Self.SurfaceFormat, &SurfaceFormatProperties);
+        Self.DirectSwapchainOutput = (Self.Headless || (Self.SurfaceCapabilities.supportedUsageFlags & VK_IMAGE_USAGE_STORAGE_BIT) != 0)
+                                  && (SurfaceFormatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT) != 0
+                                  && (Self.StorageWriteWithoutFormat || Self.SurfaceFormat == VK_FORMAT_R8G8B8A8_UNORM)
+                                  && !env_read_string("KOMPUTE_BLIT_OUTPUT")
+                                  && !Self.AsyncCompute
+                                  && !Self.DynamicResolution;
+        // Aliased images would let the next frame's async dispatch overwrite the one still being blitted.
+        Self.AliasComputeImages = env_read_string("KOMPUTE_ALIAS_COMPUTE_IMAGES").has_value() && !Self.AsyncCompute;
+
+        // The blit reads ComputeImage and writes the swapchain image once more on top of the compute shader writes.
+        auto BlitBytes = 2.0 * 4.0 * f64(Self.SurfaceCapabilities.currentExtent.width) * f64(Self.SurfaceCapabilities.currentExtent.height);
+        if (Self.DirectSwapchainOutput) {
+            std::println(stdout, "[info]: output path: direct to swapchain, {:.1f} MiB of blit traffic saved per frame at {}x{}", BlitBytes / f64(1 << 20), Self.SurfaceCapabilities.currentExtent.width, Self.SurfaceCapabilities.currentExtent.height);
+        } else {
+            std::println(stdout, "[info]: output path: blit, {:.1f} MiB of blit traffic per frame at {}x{}, {} compute images", BlitBytes / f64(1 << 20), Self.SurfaceCapabilities.currentExtent.width, Self.SurfaceCapabilities.currentExtent.height, Self.AliasComputeImages ? "aliased" : "per-frame");
+        }
+    }
+
+    void CreateVulkanTextures(this VulkanApplication& Self, VkSwapchainKHR OldSwapchain) {
+        // Headless runs render into offscreen images that take the place of the swapchain images, one per frame slot.
+        if (Self.Headless) {
+            Self.Swapchain = VK_NULL_HANDLE;
+            Self.SurfaceImageCount = Self.FrameSlotCount;
+            Self.SurfaceImages = new VkImage[Self.SurfaceImageCount];
+            for (u32 i = 0; i < Self.SurfaceImageCount; i += 1) {
+                Self.DeviceDispatcher->vkCreateImage(
+                    Self.LogicalDevice,
+                    (VkImageCreateInfo[]){{
+                        .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                        .pNext = {},
+                        .flags = {},
+                        .imageType = VK_IMAGE_TYPE_2D,
+                        .format = Self.SurfaceFormat,
+                        .extent = VkExtent3D{
+                            .width = Self.SurfaceCapabilities.currentExtent.width,
+                            .height = Self.SurfaceCapabilities.currentExtent.height,
+                            .depth = 1
+                        },
+                        .mipLevels = 1,
+                        .arrayLayers = 1,
+                        .samples = VK_SAMPLE_COUNT_1_BIT,
+                        .tiling = VK_IMAGE_TILING_OPTIMAL,
+                        .usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+                        .queueFamilyIndexCount = 0,
+                        .pQueueFamilyIndices = {},
+                        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                    }},
+                    nullptr,
+                    &Self.SurfaceImages[i]
+                );
+            }
+            VkMemoryRequirements SurfaceImageMemoryRequirements;
+            Self.DeviceDispatcher->vkGetImageMemoryRequirements(Self.LogicalDevice, Self.SurfaceImages[0], &SurfaceImageMemoryRequirements);
+            auto SurfaceImageStride = (SurfaceImageMemoryRequirements.size + SurfaceImageMemoryRequirements.alignment - 1) / SurfaceImageMemoryRequirements.alignment * SurfaceImageMemoryRequirements.alignment;
+            Self.DeviceDispatcher->vkAllocateMemory(
+                Self.LogicalDevice,
+                (VkMemoryAllocateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+                    .pNext = {},
+                    .allocationSize = SurfaceImageStride * Self.SurfaceImageCount,
+                    .memoryTypeIndex = Self.FindMemoryTypeIndex(SurfaceImageMemoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+                }},
+                nullptr,
+                &Self.SurfaceImageMemory
+            );
+            for (u32 i = 0; i < Self.SurfaceImageCount; i += 1) {
+                Self.DeviceDispatcher->vkBindImageMemory(Self.LogicalDevice, Self.SurfaceImages[i], Self.SurfaceImageMemory, i * SurfaceImageStride);
+            }
+        } else {
+            Self.DeviceDispatcher->vkCreateSwapchainKHR(
+                Self.LogicalDevice,
+                (VkSwapchainCreateInfoKHR[]){{
+                    .sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+                    .pNext = {},
+                    .flags = {},
+                    .surface = Self.Surface,
+                    .minImageCount = Self.SurfaceMinImageCount,
+                    .imageFormat = Self.SurfaceFormat,
+                    .imageColorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
+                    .imageExtent = Self.SurfaceCapabilities.currentExtent,
+                    .imageArrayLayers = 1,
+                    .imageUsage = Self.DirectSwapchainOutput ? VK_IMAGE_USAGE_STORAGE_BIT : VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+                    .imageSharingMode = VK_SHARING_MODE_EXCLUSIVE,
+                    .queueFamilyIndexCount = 0,
+                    .pQueueFamilyIndices = {},
+                    .preTransform = Self.SurfaceCapabilities.currentTransform,
+                    .compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+                    .presentMode = Self.PresentMode,
+                    .clipped = VK_FALSE,
+                    .oldSwapchain = OldSwapchain,
+                }},
+                nullptr,
+                &Self.Swapchain
+            );
+            Self.DeviceDispatcher->vkGetSwapchainImagesKHR(Self.LogicalDevice, Self.Swapchain, &Self.SurfaceImageCount, nullptr);
+            Self.SurfaceImages = new VkImage[Self.SurfaceImageCount];
+            Self.DeviceDispatcher->vkGetSwapchainImagesKHR(Self.LogicalDevice, Self.Swapchain, &Self.SurfaceImageCount, Self.SurfaceImages);
+        }
+
+        Self.SurfaceImageViews = new VkImageView[Self.SurfaceImageCount];
+        for (u32 i = 0; i < Self.SurfaceImageCount; i += 1) {
+            Self.DeviceDispatcher->vkCreateImageView(
+                Self.LogicalDevice,
+                (VkImageViewCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+                    .pNext = {},
+                    .flags = {},
+                    .image = Self.SurfaceImages[i],
+                    .viewType = VK_IMAGE_VIEW_TYPE_2D,
+                    .format = Self.SurfaceFormat,
+                    .components = VkComponentMapping{
+                        .r = VK_COMPONENT_SWIZZLE_R,
                         .g = VK_COMPONENT_SWIZZLE_G,
                         .b = VK_COMPONENT_SWIZZLE_B,
                         .a = VK_COMPONENT_SWIZZLE_A,
@@ -487,34 +2073,57 @@ struct VulkanApplication {
                 &Self.SurfaceImageViews[i]
             );
         }
-        Self.DeviceDispatcher->vkCreateImage(
-            Self.LogicalDevice,
-            (VkImageCreateInfo[]){{
-                .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
-                .pNext = {},
-                .flags = {},
-                .imageType = VK_IMAGE_TYPE_2D,
-                .format = VK_FORMAT_R8G8B8A8_UNORM,
-                .extent = VkExtent3D{
-                    .width = Self.SurfaceCapabilities.currentExtent.width,
-                    .height = Self.SurfaceCapabilities.currentExtent.height,
-                    .depth = 1
-                },
-                .mipLevels = 1,
-                .arrayLayers = 1,
-                .samples = VK_SAMPLE_COUNT_1_BIT,
-                .tiling = VK_IMAGE_TILING_OPTIMAL,
-                .usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
-                .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
-                .queueFamilyIndexCount = 0,
-                .pQueueFamilyIndices = {},
-                .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-            }},
-            nullptr,
-            &Self.ComputeImage
-        );
+
+        // New images hold nothing yet, so damage tracking draws them whole first.
+        Self.SurfaceImageVersions.assign(Self.SurfaceImageCount, 0);
+        Self.PresentedVersion = 0;
+        Self.ComputeImageVersions.assign(Self.FrameSlotCount, 0);
+
+        // The direct path writes into the swapchain images, so there are no intermediate images to create.
+        if (Self.DirectSwapchainOutput) {
+            Self.ComputeImageCount = 0;
+            Self.ComputeImages = nullptr;
+            Self.ComputeImageViews = nullptr;
+            Self.ComputeImageMemory = VK_NULL_HANDLE;
+            return;
+        }
+
+        // One ComputeImage per frame slot, all bound to one allocation: side by side, or at the same offset when
+        // they alias.
+        Self.ComputeImageCount = Self.FrameSlotCount;
+        Self.ComputeImages = new VkImage[Self.ComputeImageCount];
+        Self.ComputeImageViews = new VkImageView[Self.ComputeImageCount];
+        for (u32 i = 0; i < Self.ComputeImageCount; i += 1) {
+            Self.DeviceDispatcher->vkCreateImage(
+                Self.LogicalDevice,
+                (VkImageCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+                    .pNext = {},
+                    .flags = {},
+                    .imageType = VK_IMAGE_TYPE_2D,
+                    .format = VK_FORMAT_R8G8B8A8_UNORM,
+                    .extent = VkExtent3D{
+                        .width = Self.SurfaceCapabilities.currentExtent.width,
+                        .height = Self.SurfaceCapabilities.currentExtent.height,
+                        .depth = 1
+                    },
+                    .mipLevels = 1,
+                    .arrayLayers = 1,
+                    .samples = VK_SAMPLE_COUNT_1_BIT,
+                    .tiling = VK_IMAGE_TILING_OPTIMAL,
+                    .usage = VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                    .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+                    .queueFamilyIndexCount = 0,
+                    .pQueueFamilyIndices = {},
+                    .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                }},
+                nullptr,
+                &Self.ComputeImages[i]
+            );
+        }
         VkMemoryRequirements ComputeImageMemoryRequirements;
-        Self.DeviceDispatcher->vkGetImageMemoryRequirements(Self.LogicalDevice, Self.ComputeImage, &ComputeImageMemoryRequirements);
+        Self.DeviceDispatcher->vkGetImageMemoryRequirements(Self.LogicalDevice, Self.ComputeImages[0], &ComputeImageMemoryRequirements);
+        auto ComputeImageStride = Self.AliasComputeImages ? 0zu : (ComputeImageMemoryRequirements.size + ComputeImageMemoryRequirements.alignment - 1) / ComputeImageMemoryRequirements.alignment * ComputeImageMemoryRequirements.alignment;
         Self.DeviceDispatcher->vkAllocateMemory(
             Self.LogicalDevice,
             (VkMemoryAllocateInfo[]){{
@@ -523,106 +2132,632 @@ struct VulkanApplication {
                     .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO,
                     .flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT
                 }},
-                .allocationSize = ComputeImageMemoryRequirements.size,
-                .memoryTypeIndex = 0
+                .allocationSize = ComputeImageStride * (Self.ComputeImageCount - 1) + ComputeImageMemoryRequirements.size,
+                .memoryTypeIndex = Self.FindMemoryTypeIndex(ComputeImageMemoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
             }},
             nullptr,
             &Self.ComputeImageMemory
         );
-        Self.DeviceDispatcher->vkBindImageMemory(Self.LogicalDevice, Self.ComputeImage, Self.ComputeImageMemory, 0zu);
-        Self.DeviceDispatcher->vkCreateImageView(
-            Self.LogicalDevice,
-            (VkImageViewCreateInfo[]){{
-                .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
-                .pNext = {},
-                .flags = {},
-                .image = Self.ComputeImage,
-                .viewType = VK_IMAGE_VIEW_TYPE_2D,
-                .format = VK_FORMAT_R8G8B8A8_UNORM,
-                .components = VkComponentMapping{
-                    .r = VK_COMPONENT_SWIZZLE_R,
-                    .g = VK_COMPONENT_SWIZZLE_G,
-                    .b = VK_COMPONENT_SWIZZLE_B,
-                    .a = VK_COMPONENT_SWIZZLE_A,
-                },
-                .subresourceRange = VkImageSubresourceRange{
-                    .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
-                    .baseMipLevel = 0,
-                    .levelCount = 1,
-                    .baseArrayLayer = 0,
-                    .layerCount = 1
-                }
-            }},
-            nullptr,
-            &Self.ComputeImageView
-        );
+        for (u32 i = 0; i < Self.ComputeImageCount; i += 1) {
+            Self.DeviceDispatcher->vkBindImageMemory(Self.LogicalDevice, Self.ComputeImages[i], Self.ComputeImageMemory, i * ComputeImageStride);
+            Self.DeviceDispatcher->vkCreateImageView(
+                Self.LogicalDevice,
+                (VkImageViewCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+                    .pNext = {},
+                    .flags = {},
+                    .image = Self.ComputeImages[i],
+                    .viewType = VK_IMAGE_VIEW_TYPE_2D,
+                    .format = VK_FORMAT_R8G8B8A8_UNORM,
+                    .components = VkComponentMapping{
+                        .r = VK_COMPONENT_SWIZZLE_R,
+                        .g = VK_COMPONENT_SWIZZLE_G,
+                        .b = VK_COMPONENT_SWIZZLE_B,
+                        .a = VK_COMPONENT_SWIZZLE_A,
+                    },
+                    .subresourceRange = VkImageSubresourceRange{
+                        .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                        .baseMipLevel = 0,
+                        .levelCount = 1,
+                        .baseArrayLayer = 0,
+                        .layerCount = 1
+                    }
+                }},
+                nullptr,
+                &Self.ComputeImageViews[i]
+            );
+        }
     }
 
     void DeleteVulkanTextures(this VulkanApplication& Self) {
         for (u32 i = 0; i < Self.SurfaceImageCount; i += 1) {
             Self.DeviceDispatcher->vkDestroyImageView(Self.LogicalDevice, Self.SurfaceImageViews[i], nullptr);
         }
-        Self.DeviceDispatcher->vkDestroySwapchainKHR(Self.LogicalDevice, Self.Swapchain, nullptr);
+        if (Self.Headless) {
+            for (u32 i = 0; i < Self.SurfaceImageCount; i += 1) {
+                Self.DeviceDispatcher->vkDestroyImage(Self.LogicalDevice, Self.SurfaceImages[i], nullptr);
+            }
+            Self.DeviceDispatcher->vkFreeMemory(Self.LogicalDevice, Self.SurfaceImageMemory, nullptr);
+        } else {
+            Self.DeviceDispatcher->vkDestroySwapchainKHR(Self.LogicalDevice, Self.Swapchain, nullptr);
+        }
 
-        Self.DeviceDispatcher->vkDestroyImageView(Self.LogicalDevice, Self.ComputeImageView, nullptr);
-        Self.DeviceDispatcher->vkDestroyImage(Self.LogicalDevice, Self.ComputeImage, nullptr);
+        for (u32 i = 0; i < Self.ComputeImageCount; i += 1) {
+            Self.DeviceDispatcher->vkDestroyImageView(Self.LogicalDevice, Self.ComputeImageViews[i], nullptr);
+            Self.DeviceDispatcher->vkDestroyImage(Self.LogicalDevice, Self.ComputeImages[i], nullptr);
+        }
         Self.DeviceDispatcher->vkFreeMemory(Self.LogicalDevice, Self.ComputeImageMemory, nullptr);
 
-        delete[] Self.SurfaceImages;
-        delete[] Self.SurfaceImageViews;
+        delete[] Self.SurfaceImages;
+        delete[] Self.SurfaceImageViews;
+        delete[] Self.ComputeImages;
+        delete[] Self.ComputeImageViews;
+    }
+
+    // Builds the swapchain, ComputeImages, descriptors and recorded commands for the current surface extent next to
+    // the old ones instead of waiting for the device to go idle. Returns false while the window has no area.
+    auto RecreateVulkanTextures(this VulkanApplication& Self, u64 RetireValue) -> bool {
+        Self.UpdateSurfaceCapabilities();
+        if (Self.SurfaceCapabilities.currentExtent.width == 0 || Self.SurfaceCapabilities.currentExtent.height == 0) {
+            return false;
+        }
+        Self.UpdateRenderExtent();
+
+        auto Retired = RetiredTextureSet{
+            .RetireValue = RetireValue,
+            .Swapchain = Self.Swapchain,
+            .SurfaceImageCount = Self.SurfaceImageCount,
+            .SurfaceImages = Self.SurfaceImages,
+            .SurfaceImageViews = Self.SurfaceImageViews,
+            .ComputeImageCount = Self.ComputeImageCount,
+            .ComputeImages = Self.ComputeImages,
+            .ComputeImageViews = Self.ComputeImageViews,
+            .ComputeImageMemory = Self.ComputeImageMemory,
+            .ComputeDescriptorPool = Self.ComputeDescriptorStrategy == DescriptorStrategy::Persistent ? Self.ComputeDescriptorPool : VK_NULL_HANDLE,
+            .ComputeDescriptorSets = Self.ComputeDescriptorStrategy == DescriptorStrategy::Persistent ? Self.ComputeDescriptorSets : nullptr,
+            .ComputeDescriptorBuffer = Self.ComputeDescriptorStrategy == DescriptorStrategy::Buffer ? Self.ComputeDescriptorBuffer : VK_NULL_HANDLE,
+            .ComputeDescriptorBufferMemory = Self.ComputeDescriptorStrategy == DescriptorStrategy::Buffer ? Self.ComputeDescriptorBufferMemory : VK_NULL_HANDLE,
+            .RecordedCommandPools = Self.PrerecordCommands ? Self.RecordedCommandPools : nullptr,
+            .RecordedCommandBuffers = Self.PrerecordCommands ? Self.RecordedCommandBuffers : nullptr,
+        };
+        Self.CreateVulkanTextures(Retired.Swapchain);
+        Self.CreateComputeDescriptors();
+        Self.CreateRecordedCommands();
+        Self.RetiredTextureSets.push_back(Retired);
+
+        std::println(stdout, "[info]: swapchain recreated at {}x{}", Self.SurfaceCapabilities.currentExtent.width, Self.SurfaceCapabilities.currentExtent.height);
+        return true;
+    }
+
+    // Destroys every retired set whose frames have finished, i.e. whose RetireValue the timeline has reached.
+    void DeleteRetiredTextures(this VulkanApplication& Self, u64 CompletedValue) {
+        std::erase_if(Self.RetiredTextureSets, [&](RetiredTextureSet const& Retired) {
+            if (Retired.RetireValue > CompletedValue) {
+                return false;
+            }
+            for (u32 i = 0; Retired.RecordedCommandPools != nullptr && i < Self.FrameSlotCount; i += 1) {
+                Self.DeviceDispatcher->vkDestroyCommandPool(Self.LogicalDevice, Retired.RecordedCommandPools[i], nullptr);
+            }
+            Self.DeviceDispatcher->vkDestroyDescriptorPool(Self.LogicalDevice, Retired.ComputeDescriptorPool, nullptr);
+            Self.DeviceDispatcher->vkDestroyBuffer(Self.LogicalDevice, Retired.ComputeDescriptorBuffer, nullptr);
+            Self.DeviceDispatcher->vkFreeMemory(Self.LogicalDevice, Retired.ComputeDescriptorBufferMemory, nullptr);
+            for (u32 i = 0; i < Retired.SurfaceImageCount; i += 1) {
+                Self.DeviceDispatcher->vkDestroyImageView(Self.LogicalDevice, Retired.SurfaceImageViews[i], nullptr);
+            }
+            Self.DeviceDispatcher->vkDestroySwapchainKHR(Self.LogicalDevice, Retired.Swapchain, nullptr);
+            for (u32 i = 0; i < Retired.ComputeImageCount; i += 1) {
+                Self.DeviceDispatcher->vkDestroyImageView(Self.LogicalDevice, Retired.ComputeImageViews[i], nullptr);
+                Self.DeviceDispatcher->vkDestroyImage(Self.LogicalDevice, Retired.ComputeImages[i], nullptr);
+            }
+            Self.DeviceDispatcher->vkFreeMemory(Self.LogicalDevice, Retired.ComputeImageMemory, nullptr);
+            delete[] Retired.SurfaceImages;
+            delete[] Retired.SurfaceImageViews;
+            delete[] Retired.ComputeImages;
+            delete[] Retired.ComputeImageViews;
+            delete[] Retired.ComputeDescriptorSets;
+            delete[] Retired.RecordedCommandPools;
+            delete[] Retired.RecordedCommandBuffers;
+            return true;
+        });
+    }
+
+    auto FindMemoryTypeIndex(this VulkanApplication& Self, u32 MemoryTypeBits, VkMemoryPropertyFlags PropertyFlags) -> u32 {
+        VkPhysicalDeviceMemoryProperties MemoryProperties;
+        Self.InstanceDispatcher->vkGetPhysicalDeviceMemoryProperties(Self.PhysicalDevice, &MemoryProperties);
+        for (u32 i = 0; i < MemoryProperties.memoryTypeCount; i += 1) {
+            if ((MemoryTypeBits & (1u << i)) != 0 && (MemoryProperties.memoryTypes[i].propertyFlags & PropertyFlags) == PropertyFlags) {
+                return i;
+            }
+        }
+        std::println(stderr, "[error]: no memory type with property flags {:#x}", PropertyFlags);
+        std::abort();
+    }
+
+    // Compute outputs are the frame slot's ComputeImage on the blit path and the swapchain image on the direct path.
+    auto ComputeOutputIndex(this VulkanApplication& Self, u32 FrameIndex, u32 ImageIndex) -> u32 {
+        return Self.DirectSwapchainOutput ? ImageIndex : FrameIndex;
+    }
+
+    auto ComputeOutputView(this VulkanApplication& Self, u32 OutputIndex) -> VkImageView {
+        return Self.DirectSwapchainOutput ? Self.SurfaceImageViews[OutputIndex] : Self.ComputeImageViews[OutputIndex];
+    }
+
+    // Writes the descriptor of every compute output once, in whatever form the descriptor strategy binds it.
+    void CreateComputeDescriptors(this VulkanApplication& Self) {
+        Self.ComputeDescriptorCount = Self.DirectSwapchainOutput ? Self.SurfaceImageCount : Self.ComputeImageCount;
+        switch (Self.ComputeDescriptorStrategy) {
+        case DescriptorStrategy::Persistent: {
+            Self.DeviceDispatcher->vkCreateDescriptorPool(
+                Self.LogicalDevice,
+                (VkDescriptorPoolCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+                    .pNext = {},
+                    .flags = {},
+                    .maxSets = Self.ComputeDescriptorCount,
+                    .poolSizeCount = 1,
+                    .pPoolSizes = (VkDescriptorPoolSize[]) {
+                        VkDescriptorPoolSize(VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, Self.ComputeDescriptorCount)
+                    }
+                }},
+                nullptr,
+                &Self.ComputeDescriptorPool
+            );
+            auto SetLayouts = std::vector<VkDescriptorSetLayout>(Self.ComputeDescriptorCount, Self.ComputeDescriptorSetLayout);
+            Self.ComputeDescriptorSets = new VkDescriptorSet[Self.ComputeDescriptorCount];
+            Self.DeviceDispatcher->vkAllocateDescriptorSets(
+                Self.LogicalDevice,
+                (VkDescriptorSetAllocateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+                    .pNext = {},
+                    .descriptorPool = Self.ComputeDescriptorPool,
+                    .descriptorSetCount = Self.ComputeDescriptorCount,
+                    .pSetLayouts = SetLayouts.data()
+                }},
+                Self.ComputeDescriptorSets
+            );
+            for (u32 i = 0; i < Self.ComputeDescriptorCount; i += 1) {
+                Self.DeviceDispatcher->vkUpdateDescriptorSets(
+                    Self.LogicalDevice,
+                    1, (VkWriteDescriptorSet[]){
+                        VkWriteDescriptorSet{
+                            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                            .pNext = {},
+                            .dstSet = Self.ComputeDescriptorSets[i],
+                            .dstBinding = 0,
+                            .dstArrayElement = 0,
+                            .descriptorCount = 1,
+                            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                            .pImageInfo = (VkDescriptorImageInfo[]){{
+                                .sampler = {},
+                                .imageView = Self.ComputeOutputView(i),
+                                .imageLayout = VK_IMAGE_LAYOUT_GENERAL
+                            }},
+                            .pBufferInfo = {},
+                            .pTexelBufferView = {},
+                        }
+                    },
+                    0, (VkCopyDescriptorSet[]){}
+                );
+            }
+            break;
+        }
+        case DescriptorStrategy::Push: {
+            break;
+        }
+        case DescriptorStrategy::Buffer: {
+            VkDeviceSize DescriptorSetLayoutSize;
+            VkDeviceSize DescriptorBindingOffset;
+            Self.DeviceDispatcher->vkGetDescriptorSetLayoutSizeEXT(Self.LogicalDevice, Self.ComputeDescriptorSetLayout, &DescriptorSetLayoutSize);
+            Self.DeviceDispatcher->vkGetDescriptorSetLayoutBindingOffsetEXT(Self.LogicalDevice, Self.ComputeDescriptorSetLayout, 0, &DescriptorBindingOffset);
+            auto OffsetAlignment = Self.DescriptorBufferProperties.descriptorBufferOffsetAlignment;
+            Self.ComputeDescriptorBufferStride = (DescriptorSetLayoutSize + OffsetAlignment - 1) / OffsetAlignment * OffsetAlignment;
+
+            Self.DeviceDispatcher->vkCreateBuffer(
+                Self.LogicalDevice,
+                (VkBufferCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+                    .pNext = {},
+                    .flags = {},
+                    .size = Self.ComputeDescriptorBufferStride * Self.ComputeDescriptorCount,
+                    .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+                    .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+                    .queueFamilyIndexCount = 0,
+                    .pQueueFamilyIndices = {}
+                }},
+                nullptr,
+                &Self.ComputeDescriptorBuffer
+            );
+            VkMemoryRequirements DescriptorBufferMemoryRequirements;
+            Self.DeviceDispatcher->vkGetBufferMemoryRequirements(Self.LogicalDevice, Self.ComputeDescriptorBuffer, &DescriptorBufferMemoryRequirements);
+            Self.DeviceDispatcher->vkAllocateMemory(
+                Self.LogicalDevice,
+                (VkMemoryAllocateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+                    .pNext = (VkMemoryAllocateFlagsInfo[]){{
+                        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO,
+                        .pNext = {},
+                        .flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT,
+                        .deviceMask = 0
+                    }},
+                    .allocationSize = DescriptorBufferMemoryRequirements.size,
+                    .memoryTypeIndex = Self.FindMemoryTypeIndex(DescriptorBufferMemoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+                }},
+                nullptr,
+                &Self.ComputeDescriptorBufferMemory
+            );
+            Self.DeviceDispatcher->vkBindBufferMemory(Self.LogicalDevice, Self.ComputeDescriptorBuffer, Self.ComputeDescriptorBufferMemory, 0zu);
+            Self.ComputeDescriptorBufferAddress = Self.DeviceDispatcher->vkGetBufferDeviceAddress(
+                Self.LogicalDevice,
+                (VkBufferDeviceAddressInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+                    .pNext = {},
+                    .buffer = Self.ComputeDescriptorBuffer
+                }}
+            );
+
+            void* DescriptorBufferData;
+            Self.DeviceDispatcher->vkMapMemory(Self.LogicalDevice, Self.ComputeDescriptorBufferMemory, 0zu, VK_WHOLE_SIZE, VkMemoryMapFlags(), &DescriptorBufferData);
+            for (u32 i = 0; i < Self.ComputeDescriptorCount; i += 1) {
+                Self.DeviceDispatcher->vkGetDescriptorEXT(
+                    Self.LogicalDevice,
+                    (VkDescriptorGetInfoEXT[]){{
+                        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+                        .pNext = {},
+                        .type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                        .data = VkDescriptorDataEXT{
+                            .pStorageImage = (VkDescriptorImageInfo[]){{
+                                .sampler = {},
+                                .imageView = Self.ComputeOutputView(i),
+                                .imageLayout = VK_IMAGE_LAYOUT_GENERAL
+                            }}
+                        }
+                    }},
+                    Self.DescriptorBufferProperties.storageImageDescriptorSize,
+                    static_cast<u8*>(DescriptorBufferData) + i * Self.ComputeDescriptorBufferStride + DescriptorBindingOffset
+                );
+            }
+            Self.DeviceDispatcher->vkUnmapMemory(Self.LogicalDevice, Self.ComputeDescriptorBufferMemory);
+            break;
+        }
+        }
+    }
+
+    void DeleteComputeDescriptors(this VulkanApplication& Self) {
+        switch (Self.ComputeDescriptorStrategy) {
+        case DescriptorStrategy::Persistent: {
+            Self.DeviceDispatcher->vkDestroyDescriptorPool(Self.LogicalDevice, Self.ComputeDescriptorPool, nullptr);
+            delete[] Self.ComputeDescriptorSets;
+            break;
+        }
+        case DescriptorStrategy::Push: {
+            break;
+        }
+        case DescriptorStrategy::Buffer: {
+            Self.DeviceDispatcher->vkDestroyBuffer(Self.LogicalDevice, Self.ComputeDescriptorBuffer, nullptr);
+            Self.DeviceDispatcher->vkFreeMemory(Self.LogicalDevice, Self.ComputeDescriptorBufferMemory, nullptr);
+            break;
+        }
+        }
+    }
+
+    void BindComputeDescriptors(this VulkanApplication& Self, VkCommandBuffer CommandBuffer, u32 OutputIndex) {
+        switch (Self.ComputeDescriptorStrategy) {
+        case DescriptorStrategy::Persistent: {
+            Self.DeviceDispatcher->vkCmdBindDescriptorSets(CommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, Self.ComputePipelineLayout, 0, 1, &Self.ComputeDescriptorSets[OutputIndex], 0, {});
+            break;
+        }
+        case DescriptorStrategy::Push: {
+            Self.DeviceDispatcher->vkCmdPushDescriptorSetKHR(
+                CommandBuffer,
+                VK_PIPELINE_BIND_POINT_COMPUTE,
+                Self.ComputePipelineLayout,
+                0,
+                1, (VkWriteDescriptorSet[]){
+                    VkWriteDescriptorSet{
+                        .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                        .pNext = {},
+                        .dstSet = {},
+                        .dstBinding = 0,
+                        .dstArrayElement = 0,
+                        .descriptorCount = 1,
+                        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+                        .pImageInfo = (VkDescriptorImageInfo[]){{
+                            .sampler = {},
+                            .imageView = Self.ComputeOutputView(OutputIndex),
+                            .imageLayout = VK_IMAGE_LAYOUT_GENERAL
+                        }},
+                        .pBufferInfo = {},
+                        .pTexelBufferView = {},
+                    }
+                }
+            );
+            break;
+        }
+        case DescriptorStrategy::Buffer: {
+            Self.DeviceDispatcher->vkCmdBindDescriptorBuffersEXT(
+                CommandBuffer,
+                1, (VkDescriptorBufferBindingInfoEXT[]){{
+                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+                    .pNext = {},
+                    .address = Self.ComputeDescriptorBufferAddress,
+                    .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT
+                }}
+            );
+            Self.DeviceDispatcher->vkCmdSetDescriptorBufferOffsetsEXT(CommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, Self.ComputePipelineLayout, 0, 1, (u32[]){ 0 }, (VkDeviceSize[]){ OutputIndex * Self.ComputeDescriptorBufferStride });
+            break;
+        }
+        }
+    }
+
+    // Set KOMPUTE_PRERECORD_COMMANDS to record the frame once per frame slot and swapchain image and resubmit it
+    // unchanged; swapchain recreation records a fresh set. Each frame slot has its own pool, so when the pipeline
+    // changes, StartLoop re-records a slot's buffers just before the slot is next used, once its previous frame has
+    // completed, instead of waiting for the whole queue.
+    void CreateRecordedCommands(this VulkanApplication& Self) {
+        if (!Self.PrerecordCommands) {
+            return;
+        }
+
+        Self.RecordedCommandPools = new VkCommandPool[Self.FrameSlotCount];
+        Self.RecordedCommandBuffers = new VkCommandBuffer[Self.FrameSlotCount * Self.SurfaceImageCount];
+        for (u32 i = 0; i < Self.FrameSlotCount; i += 1) {
+            Self.DeviceDispatcher->vkCreateCommandPool(
+                Self.LogicalDevice,
+                (VkCommandPoolCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                    .pNext = {},
+                    .flags = {},
+                    .queueFamilyIndex = Self.QueueFamilyIndex
+                }},
+                nullptr,
+                &Self.RecordedCommandPools[i]
+            );
+            Self.DeviceDispatcher->vkAllocateCommandBuffers(
+                Self.LogicalDevice,
+                (VkCommandBufferAllocateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                    .commandPool = Self.RecordedCommandPools[i],
+                    .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+                    .commandBufferCount = Self.SurfaceImageCount,
+                }},
+                &Self.RecordedCommandBuffers[i * Self.SurfaceImageCount]
+            );
+            Self.RecordSlotCommandBuffers(i);
+        }
+    }
+
+    void DeleteRecordedCommands(this VulkanApplication& Self) {
+        if (!Self.PrerecordCommands) {
+            return;
+        }
+        for (u32 i = 0; i < Self.FrameSlotCount; i += 1) {
+            Self.DeviceDispatcher->vkDestroyCommandPool(Self.LogicalDevice, Self.RecordedCommandPools[i], nullptr);
+        }
+        delete[] Self.RecordedCommandPools;
+        delete[] Self.RecordedCommandBuffers;
+    }
+
+    // Buffer FrameIndex * SurfaceImageCount + ImageIndex holds the frame for that slot and image. The slot's buffers
+    // must not be pending.
+    void RecordSlotCommandBuffers(this VulkanApplication& Self, u32 FrameIndex) {
+        for (u32 i = 0; i < Self.SurfaceImageCount; i += 1) {
+            Self.RecordFrameCommands(Self.RecordedCommandBuffers[FrameIndex * Self.SurfaceImageCount + i], FrameIndex, i, VkCommandBufferUsageFlags());
+        }
+        Self.RecordedPipelines[FrameIndex] = Self.ComputePipeline;
+    }
+
+    // KOMPUTE_RECORD_THREADS=N records each pass of the frame into its own secondary command buffer on N threads,
+    // the main thread included, and the primary buffer executes them in RECORD_PASS_NAMES order. Every worker owns a
+    // transient pool per frame slot that is reset as a whole once the slot's previous frame has completed, instead
+    // of resetting buffers one by one. Async compute and prerecorded commands keep their own recording.
+    void CreateRecordWorkers(this VulkanApplication& Self) {
+        Self.RecordSecondaryCommands = false;
+        auto ThreadCountString = env_read_string("KOMPUTE_RECORD_THREADS");
+        if (!ThreadCountString) {
+            return;
+        }
+        if (Self.AsyncCompute || Self.PrerecordCommands) {
+            std::println(stderr, "[warning]: KOMPUTE_RECORD_THREADS is ignored with async compute or prerecorded commands");
+            return;
+        }
+        u32 ThreadCount = 1;
+        std::from_chars(ThreadCountString->data(), ThreadCountString->data() + ThreadCountString->size(), ThreadCount);
+        // Threads beyond one per pass would have nothing to record.
+        ThreadCount = std::clamp(ThreadCount, 1u, RECORD_PASS_COUNT);
+
+        Self.RecordSecondaryCommands = true;
+        Self.RecordCommandPools = new VkCommandPool[Self.FrameSlotCount * ThreadCount];
+        Self.RecordSecondaryCommandBuffers = new VkCommandBuffer[Self.FrameSlotCount * RECORD_PASS_COUNT];
+        for (u32 i = 0; i < Self.FrameSlotCount * ThreadCount; i += 1) {
+            Self.DeviceDispatcher->vkCreateCommandPool(
+                Self.LogicalDevice,
+                (VkCommandPoolCreateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+                    .pNext = {},
+                    .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+                    .queueFamilyIndex = Self.QueueFamilyIndex
+                }},
+                nullptr,
+                &Self.RecordCommandPools[i]
+            );
+        }
+        // Pass p of slot f is recorded by worker p % ThreadCount, so it is allocated from that worker's pool.
+        for (u32 i = 0; i < Self.FrameSlotCount * RECORD_PASS_COUNT; i += 1) {
+            Self.DeviceDispatcher->vkAllocateCommandBuffers(
+                Self.LogicalDevice,
+                (VkCommandBufferAllocateInfo[]){{
+                    .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+                    .commandPool = Self.RecordCommandPools[i / RECORD_PASS_COUNT * ThreadCount + i % RECORD_PASS_COUNT % ThreadCount],
+                    .level = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+                    .commandBufferCount = 1,
+                }},
+                &Self.RecordSecondaryCommandBuffers[i]
+            );
+        }
+        Self.RecordWorkers.Start(ThreadCount);
+        std::println(stdout, "[info]: recording {} passes into secondary command buffers on {} threads", RECORD_PASS_COUNT, ThreadCount);
+    }
+
+    void DeleteRecordWorkers(this VulkanApplication& Self) {
+        if (!Self.RecordSecondaryCommands) {
+            return;
+        }
+        for (u32 i = 0; i < Self.FrameSlotCount * Self.RecordWorkers.WorkerCount(); i += 1) {
+            Self.DeviceDispatcher->vkDestroyCommandPool(Self.LogicalDevice, Self.RecordCommandPools[i], nullptr);
+        }
+        Self.RecordWorkers.Stop();
+        delete[] Self.RecordCommandPools;
+        delete[] Self.RecordSecondaryCommandBuffers;
+    }
+
+    // The slot's previous frame must have completed, since its pools are reset here.
+    void RecordSecondaryFrameCommands(this VulkanApplication& Self, VkCommandBuffer CommandBuffer, u32 FrameIndex, u32 ImageIndex) {
+        VkCommandBuffer* SecondaryCommandBuffers = &Self.RecordSecondaryCommandBuffers[FrameIndex * RECORD_PASS_COUNT];
+        Self.RecordWorkers.Run([&](u32 Worker) {
+            u32 WorkerCount = Self.RecordWorkers.WorkerCount();
+            Self.DeviceDispatcher->vkResetCommandPool(Self.LogicalDevice, Self.RecordCommandPools[FrameIndex * WorkerCount + Worker], VkCommandPoolResetFlags());
+            for (u32 Pass = Worker; Pass < RECORD_PASS_COUNT; Pass += WorkerCount) {
+                Self.DeviceDispatcher->vkBeginCommandBuffer(
+                    SecondaryCommandBuffers[Pass],
+                    (VkCommandBufferBeginInfo[]){{
+                        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+                        .pInheritanceInfo = (VkCommandBufferInheritanceInfo[]){{
+                            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+                            .pNext = {},
+                            .renderPass = {},
+                            .subpass = 0,
+                            .framebuffer = {},
+                            .occlusionQueryEnable = VK_FALSE,
+                            .queryFlags = {},
+                            .pipelineStatistics = {}
+                        }}
+                    }}
+                );
+                switch (Pass) {
+                case 0: {
+                    Self.RecordComputeCommands(SecondaryCommandBuffers[Pass], FrameIndex, ImageIndex);
+                    break;
+                }
+                case 1: {
+                    Self.RecordPresentCommands(SecondaryCommandBuffers[Pass], FrameIndex, ImageIndex);
+                    break;
+                }
+                }
+                Self.DeviceDispatcher->vkEndCommandBuffer(SecondaryCommandBuffers[Pass]);
+            }
+        });
+
+        Self.DeviceDispatcher->vkResetCommandPool(Self.LogicalDevice, Self.CommandPools[FrameIndex], VkCommandPoolResetFlags());
+        Self.DeviceDispatcher->vkBeginCommandBuffer(
+            CommandBuffer,
+            (VkCommandBufferBeginInfo[]){{
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+            }}
+        );
+        Self.DeviceDispatcher->vkCmdExecuteCommands(CommandBuffer, RECORD_PASS_COUNT, SecondaryCommandBuffers);
+        Self.DeviceDispatcher->vkEndCommandBuffer(CommandBuffer);
+    }
+
+    // Records the whole frame: compute dispatch into the output image, then, on the blit path, blit ComputeImage to the
+    // swapchain image, and hand the swapchain image to present.
+    void RecordFrameCommands(this VulkanApplication& Self, VkCommandBuffer CommandBuffer, u32 FrameIndex, u32 ImageIndex, VkCommandBufferUsageFlags UsageFlags) {
+        Self.DeviceDispatcher->vkBeginCommandBuffer(
+            CommandBuffer,
+            (VkCommandBufferBeginInfo[]){{
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                .flags = UsageFlags
+            }}
+        );
+        Self.RecordComputeCommands(CommandBuffer, FrameIndex, ImageIndex);
+        Self.RecordPresentCommands(CommandBuffer, FrameIndex, ImageIndex);
+        Self.DeviceDispatcher->vkEndCommandBuffer(CommandBuffer);
     }
 
-    void StartLoop(this VulkanApplication& Self) {
-        u32 FrameIndex = 0;
-        u32 TotalFrameIndex = 0;
+    // Async compute splits the frame: ComputeCommandBuffer runs the dispatch on the compute queue and releases the
+    // ComputeImage to the main queue family, CommandBuffer acquires it, blits and hands the swapchain image to present.
+    void RecordAsyncFrameCommands(this VulkanApplication& Self, VkCommandBuffer ComputeCommandBuffer, VkCommandBuffer CommandBuffer, u32 FrameIndex, u32 ImageIndex, VkCommandBufferUsageFlags UsageFlags) {
+        Self.DeviceDispatcher->vkBeginCommandBuffer(
+            ComputeCommandBuffer,
+            (VkCommandBufferBeginInfo[]){{
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                .flags = UsageFlags
+            }}
+        );
+        Self.RecordComputeCommands(ComputeCommandBuffer, FrameIndex, ImageIndex);
+        Self.DeviceDispatcher->vkEndCommandBuffer(ComputeCommandBuffer);
 
-        bool Quit = false;
-        while (!Quit) {
-            SDL_Event Event;
-            while (SDL_PollEvent(&Event) == 1) {
-                if (Event.type == SDL_QUIT) {
-                    Quit = true;
+        Self.DeviceDispatcher->vkBeginCommandBuffer(
+            CommandBuffer,
+            (VkCommandBufferBeginInfo[]){{
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+                .flags = UsageFlags
+            }}
+        );
+        Self.RecordPresentCommands(CommandBuffer, FrameIndex, ImageIndex);
+        Self.DeviceDispatcher->vkEndCommandBuffer(CommandBuffer);
+    }
+
+    // Transitions the output image for storage writes and dispatches the compute shader over its dirty tiles.
+    void RecordComputeCommands(this VulkanApplication& Self, VkCommandBuffer CommandBuffer, u32 FrameIndex, u32 ImageIndex) {
+        u32 OutputIndex = Self.ComputeOutputIndex(FrameIndex, ImageIndex);
+        Self.ResetGpuScopes(CommandBuffer, FrameIndex, GpuScope::ComputeBarrier, GpuScope::Dispatch);
+        Self.WriteGpuTimestamp(CommandBuffer, FrameIndex, GpuScope::ComputeBarrier, false);
+        Self.DeviceDispatcher->vkCmdPipelineBarrier2(
+            CommandBuffer,
+            (VkDependencyInfo[]) {{
+                .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+                .pNext = {},
+                .dependencyFlags = {},
+                .imageMemoryBarrierCount = 1,
+                .pImageMemoryBarriers = (VkImageMemoryBarrier2[]) {
+                    VkImageMemoryBarrier2{
+                        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+                        // On the direct path this chains with the acquire semaphore wait at the compute stage. Aliased
+                        // ComputeImages share memory with the previous frame's, so the write waits for its blit read.
+                        .srcStageMask = Self.DirectSwapchainOutput ? VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT
+                                      : Self.AliasComputeImages ? VK_PIPELINE_STAGE_2_TRANSFER_BIT
+                                      : VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT,
+                        .srcAccessMask = VK_ACCESS_2_NONE,
+                        .dstStageMask = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                        .dstAccessMask = VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+                        // Damage tracking keeps the tiles drawn before, from the layout the last frame left them in;
+                        // only images the application owns get there, never swapchain images.
+                        .oldLayout = Self.DispatchSinceVersion == 0 ? VK_IMAGE_LAYOUT_UNDEFINED : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                        .newLayout = VK_IMAGE_LAYOUT_GENERAL,
+                        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                        .image = Self.DirectSwapchainOutput ? Self.SurfaceImages[ImageIndex] : Self.ComputeImages[OutputIndex],
+                        .subresourceRange = VkImageSubresourceRange{
+                            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                            .baseMipLevel = 0,
+                            .levelCount = 1,
+                            .baseArrayLayer = 0,
+                            .layerCount = 1
+                        }
+                    }
                 }
-            }
+            }}
+        );
+        Self.WriteGpuTimestamp(CommandBuffer, FrameIndex, GpuScope::ComputeBarrier, true);
 
-            if (TotalFrameIndex >= MAX_FRAMES_IN_FLIGHT) {
-                Self.DeviceDispatcher->vkWaitSemaphoresKHR(
-                    Self.LogicalDevice,
-                    (VkSemaphoreWaitInfo[]){{
-                        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
-                        .pNext = {},
-                        .flags = {},
-                        .semaphoreCount = 1,
-                        .pSemaphores = (VkSemaphore[]){ Self.TimelineSemaphore },
-                        .pValues = (u64[]) { TotalFrameIndex - MAX_FRAMES_IN_FLIGHT + 1 },
-                    }},
-                    std::numeric_limits<u64>::max()
-                );
-                Self.DeviceDispatcher->vkResetDescriptorPool(Self.LogicalDevice, Self.DescriptorPools[FrameIndex], VkDescriptorPoolResetFlags());
-            }
+        Self.DeviceDispatcher->vkCmdBindPipeline(CommandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, Self.ComputePipeline);
+        Self.Timings.Mark(FramePhase::Record);
+        Self.BindComputeDescriptors(CommandBuffer, OutputIndex);
+        Self.Timings.Mark(FramePhase::Descriptors);
 
-            Self.DeviceDispatcher->vkAcquireNextImage2KHR(
-                Self.LogicalDevice,
-                (VkAcquireNextImageInfoKHR[]){{
-                    .sType = VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR,
-                    .pNext = {},
-                    .swapchain = Self.Swapchain,
-                    .timeout = std::numeric_limits<u64>::max(),
-                    .semaphore = Self.AcquireSemaphores[FrameIndex],
-                    .fence = {},
-                    .deviceMask = 1
-                }},
-                &Self.SurfaceImageIndex
-            );
-            Self.DeviceDispatcher->vkBeginCommandBuffer(
-                Self.CommandBuffers[FrameIndex],
-                (VkCommandBufferBeginInfo[]){{
-                    .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
-                    .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
-                }}
-            );
+        Self.DeviceDispatcher->vkCmdPushConstants(CommandBuffer, Self.ComputePipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(VkExtent2D), &Self.RenderExtent);
+
+        Self.WriteGpuTimestamp(CommandBuffer, FrameIndex, GpuScope::Dispatch, false);
+        for (auto const& Rect : Self.DispatchRects) {
+            Self.DeviceDispatcher->vkCmdDispatchBase(CommandBuffer, Rect.X, Rect.Y, 0, Rect.Width, Rect.Height, 1);
+        }
+        Self.WriteGpuTimestamp(CommandBuffer, FrameIndex, GpuScope::Dispatch, true);
+        // Release half of the ownership transfer; the acquire half is the first barrier of RecordPresentCommands.
+        if (Self.AsyncCompute) {
             Self.DeviceDispatcher->vkCmdPipelineBarrier2(
-                Self.CommandBuffers[FrameIndex],
+                CommandBuffer,
                 (VkDependencyInfo[]) {{
                     .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
                     .pNext = {},
@@ -631,15 +2766,15 @@ struct VulkanApplication {
                     .pImageMemoryBarriers = (VkImageMemoryBarrier2[]) {
                         VkImageMemoryBarrier2{
                             .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
-                            .srcStageMask = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT,
-                            .srcAccessMask = VK_ACCESS_2_NONE,
-                            .dstStageMask = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
-                            .dstAccessMask = VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
-                            .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-                            .newLayout = VK_IMAGE_LAYOUT_GENERAL,
-                            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                            .image = Self.ComputeImage,
+                            .srcStageMask = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                            .srcAccessMask = VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+                            .dstStageMask = VK_PIPELINE_STAGE_2_NONE,
+                            .dstAccessMask = VK_ACCESS_2_NONE,
+                            .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
+                            .newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                            .srcQueueFamilyIndex = Self.ComputeQueueFamilyIndex,
+                            .dstQueueFamilyIndex = Self.QueueFamilyIndex,
+                            .image = Self.ComputeImages[OutputIndex],
                             .subresourceRange = VkImageSubresourceRange{
                                 .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
                                 .baseMipLevel = 0,
@@ -651,70 +2786,36 @@ struct VulkanApplication {
                     }
                 }}
             );
+        }
+    }
 
-            VkDescriptorSet ComputeDescriptorSet;
-            Self.DeviceDispatcher->vkAllocateDescriptorSets(
-                Self.LogicalDevice,
-                (VkDescriptorSetAllocateInfo[]){{
-                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-                    .pNext = {},
-                    .descriptorPool = Self.DescriptorPools[FrameIndex],
-                    .descriptorSetCount = 1,
-                    .pSetLayouts = (VkDescriptorSetLayout[]){
-                        Self.ComputeDescriptorSetLayout
-                    }
-                }},
-                &ComputeDescriptorSet
-            );
-
-            Self.DeviceDispatcher->vkUpdateDescriptorSets(
-                Self.LogicalDevice,
-                1, (VkWriteDescriptorSet[]){
-                    VkWriteDescriptorSet{
-                        .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                        .pNext = {},
-                        .dstSet = ComputeDescriptorSet,
-                        .dstBinding = 0,
-                        .dstArrayElement = 0,
-                        .descriptorCount = 1,
-                        .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
-                        .pImageInfo = (VkDescriptorImageInfo[]){{
-                            .sampler = {},
-                            .imageView = Self.ComputeImageView,
-                            .imageLayout = VK_IMAGE_LAYOUT_GENERAL
-                        }},
-                        .pBufferInfo = {},
-                        .pTexelBufferView = {},
-                    }
-                },
-                0, (VkCopyDescriptorSet[]){}
-            );
-
-            Self.DeviceDispatcher->vkCmdBindPipeline(Self.CommandBuffers[FrameIndex], VK_PIPELINE_BIND_POINT_COMPUTE, Self.ComputePipeline);
-            Self.DeviceDispatcher->vkCmdBindDescriptorSets(Self.CommandBuffers[FrameIndex], VK_PIPELINE_BIND_POINT_COMPUTE, Self.ComputePipelineLayout, 0, 1, &ComputeDescriptorSet, 0, {});
-
-            auto GroupSizeX = (Self.SurfaceCapabilities.currentExtent.width + 32 - 1) / 32;
-            auto GroupSizeY = (Self.SurfaceCapabilities.currentExtent.height + 32 - 1) / 32;
-            Self.DeviceDispatcher->vkCmdDispatchBase(Self.CommandBuffers[FrameIndex], 0, 0, 0, GroupSizeX, GroupSizeY, 1);
+    // Blits the output image to the swapchain image on the blit path and transitions the swapchain image for present.
+    void RecordPresentCommands(this VulkanApplication& Self, VkCommandBuffer CommandBuffer, u32 FrameIndex, u32 ImageIndex) {
+        u32 OutputIndex = Self.ComputeOutputIndex(FrameIndex, ImageIndex);
+        Self.ResetGpuScopes(CommandBuffer, FrameIndex, GpuScope::BlitBarriers, GpuScope::PresentBarrier);
+        if (!Self.DirectSwapchainOutput) {
+            Self.WriteGpuTimestamp(CommandBuffer, FrameIndex, GpuScope::BlitBarriers, false);
             Self.DeviceDispatcher->vkCmdPipelineBarrier2(
-                Self.CommandBuffers[FrameIndex],
+                CommandBuffer,
                 (VkDependencyInfo[]) {{
                     .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
                     .pNext = {},
                     .dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT,
                     .imageMemoryBarrierCount = 2,
                     .pImageMemoryBarriers = (VkImageMemoryBarrier2[]) {
+                        // With async compute this is the acquire half of the ownership transfer; the compute timeline
+                        // wait of the submit orders it after the release.
                         VkImageMemoryBarrier2{
                             .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
-                            .srcStageMask = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
-                            .srcAccessMask = VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+                            .srcStageMask = Self.AsyncCompute ? VK_PIPELINE_STAGE_2_NONE : VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+                            .srcAccessMask = Self.AsyncCompute ? VK_ACCESS_2_NONE : VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
                             .dstStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
                             .dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT,
                             .oldLayout = VK_IMAGE_LAYOUT_GENERAL,
                             .newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                            .image = Self.ComputeImage,
+                            .srcQueueFamilyIndex = Self.AsyncCompute ? Self.ComputeQueueFamilyIndex : VK_QUEUE_FAMILY_IGNORED,
+                            .dstQueueFamilyIndex = Self.AsyncCompute ? Self.QueueFamilyIndex : VK_QUEUE_FAMILY_IGNORED,
+                            .image = Self.ComputeImages[OutputIndex],
                             .subresourceRange = VkImageSubresourceRange{
                                 .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
                                 .baseMipLevel = 0,
@@ -725,15 +2826,17 @@ struct VulkanApplication {
                         },
                         VkImageMemoryBarrier2{
                             .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
-                            .srcStageMask = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT,
+                            // Chains with the acquire semaphore wait at the transfer stage.
+                            .srcStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
                             .srcAccessMask = VK_ACCESS_2_NONE,
                             .dstStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
                             .dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT,
-                            .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                            // Only headless images keep their contents for a partial blit.
+                            .oldLayout = Self.SurfaceSinceVersion == 0 ? VK_IMAGE_LAYOUT_UNDEFINED : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                             .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                             .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
                             .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                            .image = Self.SurfaceImages[Self.SurfaceImageIndex],
+                            .image = Self.SurfaceImages[ImageIndex],
                             .subresourceRange = VkImageSubresourceRange{
                                 .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
                                 .baseMipLevel = 0,
@@ -745,93 +2848,392 @@ struct VulkanApplication {
                     }
                 }}
             );
+            Self.WriteGpuTimestamp(CommandBuffer, FrameIndex, GpuScope::BlitBarriers, true);
 
-            Self.DeviceDispatcher->vkCmdBlitImage2(
-                Self.CommandBuffers[FrameIndex],
-                (VkBlitImageInfo2[]){{
-                    .sType = VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2,
-                    .pNext = {},
-                    .srcImage = Self.ComputeImage,
-                    .srcImageLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                    .dstImage = Self.SurfaceImages[Self.SurfaceImageIndex],
-                    .dstImageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                    .regionCount = 1,
-                    .pRegions = (VkImageBlit2[]){
-                        VkImageBlit2{
-                            .sType = VK_STRUCTURE_TYPE_IMAGE_BLIT_2,
+            Self.WriteGpuTimestamp(CommandBuffer, FrameIndex, GpuScope::Blit, false);
+            if (!Self.BlitRegions.empty()) {
+                Self.DeviceDispatcher->vkCmdBlitImage2(
+                    CommandBuffer,
+                    (VkBlitImageInfo2[]){{
+                        .sType = VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2,
+                        .pNext = {},
+                        .srcImage = Self.ComputeImages[OutputIndex],
+                        .srcImageLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                        .dstImage = Self.SurfaceImages[ImageIndex],
+                        .dstImageLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                        .regionCount = u32(Self.BlitRegions.size()),
+                        .pRegions = Self.BlitRegions.data(),
+                        .filter = Self.RenderScale.Scale < 1.0 ? VK_FILTER_LINEAR : VK_FILTER_NEAREST
+                    }}
+                );
+            }
+            Self.WriteGpuTimestamp(CommandBuffer, FrameIndex, GpuScope::Blit, true);
+        }
+        Self.WriteGpuTimestamp(CommandBuffer, FrameIndex, GpuScope::PresentBarrier, false);
+        Self.DeviceDispatcher->vkCmdPipelineBarrier2(
+            CommandBuffer,
+            (VkDependencyInfo[]) {{
+                .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+                .pNext = {},
+                .dependencyFlags = {},
+                .imageMemoryBarrierCount = 1,
+                .pImageMemoryBarriers = (VkImageMemoryBarrier2[]) {
+                    VkImageMemoryBarrier2{
+                        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+                        .srcStageMask = Self.DirectSwapchainOutput ? VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT : VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                        .srcAccessMask = Self.DirectSwapchainOutput ? VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT : VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                        .dstStageMask = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT,
+                        .dstAccessMask = VK_ACCESS_2_NONE,
+                        .oldLayout = Self.DirectSwapchainOutput ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                        .newLayout = Self.Headless ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+                        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                        .image = Self.SurfaceImages[ImageIndex],
+                        .subresourceRange = VkImageSubresourceRange{
+                            .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                            .baseMipLevel = 0,
+                            .levelCount = 1,
+                            .baseArrayLayer = 0,
+                            .layerCount = 1
+                        }
+                    }
+                }
+            }}
+        );
+        Self.WriteGpuTimestamp(CommandBuffer, FrameIndex, GpuScope::PresentBarrier, true);
+    }
+
+    // The main thread only pumps SDL events and forwards them through WindowEvents; everything Vulkan happens on the
+    // render thread. A slow acquire or present no longer holds up input handling, and a burst of input costs the
+    // render thread a few queue pops instead of the SDL calls. Headless runs render on the calling thread.
+    void StartLoop(this VulkanApplication& Self) {
+        if (Self.Headless) {
+            Self.RenderLoop();
+            return;
+        }
+
+        Self.RenderFinished.store(false);
+        auto RenderThread = std::thread([&Self] {
+            Self.RenderLoop();
+            Self.RenderFinished.store(true, std::memory_order_release);
+        });
+        auto Forward = [&Self](WindowEvent const& Event) {
+            while (!Self.WindowEvents.Push(Event)) {
+                std::this_thread::yield();
+            }
+        };
+        bool Quit = false;
+        auto PumpTimeout = Self.OnDemandRendering ? ON_DEMAND_EVENT_PUMP_TIMEOUT_MILLISECONDS : EVENT_PUMP_TIMEOUT_MILLISECONDS;
+        while (!Self.RenderFinished.load(std::memory_order_acquire)) {
+            SDL_Event Event;
+            if (SDL_WaitEventTimeout(&Event, PumpTimeout) == 0) {
+                continue;
+            }
+            do {
+                auto Time = std::chrono::steady_clock::now();
+                if (Event.type == SDL_QUIT && !Quit) {
+                    Quit = true;
+                    Forward(WindowEvent{.Type = WindowEventType::Quit, .Width = 0, .Height = 0, .Key = SDLK_UNKNOWN, .Time = Time});
+                }
+                if (Event.type == SDL_WINDOWEVENT && Event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                    i32 DrawableWidth;
+                    i32 DrawableHeight;
+                    SDL_Vulkan_GetDrawableSize(Self.WindowPlatform, &DrawableWidth, &DrawableHeight);
+                    Forward(WindowEvent{.Type = WindowEventType::Resize, .Width = DrawableWidth, .Height = DrawableHeight, .Key = SDLK_UNKNOWN, .Time = Time});
+                }
+                if (Event.type == SDL_WINDOWEVENT && Event.window.event == SDL_WINDOWEVENT_EXPOSED) {
+                    Forward(WindowEvent{.Type = WindowEventType::Expose, .Width = 0, .Height = 0, .Key = SDLK_UNKNOWN, .Time = Time});
+                }
+                if (Event.type == Self.PipelineReadyEvent) {
+                    Forward(WindowEvent{.Type = WindowEventType::PipelineReady, .Width = 0, .Height = 0, .Key = SDLK_UNKNOWN, .Time = Time});
+                }
+                if (Event.type == SDL_KEYDOWN) {
+                    Forward(WindowEvent{.Type = WindowEventType::KeyDown, .Width = 0, .Height = 0, .Key = Event.key.keysym.sym, .Time = Time});
+                }
+            } while (SDL_PollEvent(&Event) == 1);
+        }
+        RenderThread.join();
+    }
+
+    void RenderLoop(this VulkanApplication& Self) {
+        u32 FrameIndex = 0;
+        u32 TotalFrameIndex = 0;
+
+        // Set KOMPUTE_PERF_L1D to count L1D read misses of the frame path (everything after event polling).
+        auto L1DMissCounter = std::optional<i32>();
+        if (env_read_string("KOMPUTE_PERF_L1D")) {
+            L1DMissCounter = perf_open_l1d_read_misses();
+            if (!L1DMissCounter) {
+                std::println(stderr, "[warning]: L1D miss counter is not available");
+            }
+        }
+        u64 L1DMisses = 0;
+
+        // With present wait, each frame remembers when its input was sampled; the latency is taken once the
+        // frame with that present id is reported on screen.
+        struct PresentSample {
+            u64 PresentId;
+            std::chrono::steady_clock::time_point InputTime;
+        };
+        auto PresentSamples = std::deque<PresentSample>();
+        auto PresentSwapchain = VkSwapchainKHR();
+        auto PresentLatencySum = std::chrono::steady_clock::duration();
+        auto PresentLatencyMax = std::chrono::steady_clock::duration();
+        u64 PresentLatencyCount = 0;
+
+        auto LoopStartTime = std::chrono::steady_clock::now();
+        bool Quit = false;
+        bool SwapchainOutOfDate = false;
+        // On demand, a frame is rendered for a resize and for new damage, and the loop sleeps on the event queue once
+        // the last change is on screen. Every event wakes the loop, which handles it and goes back to sleep unless it
+        // asked for a frame: exposes and reloaded pipelines show up as damage, and the rest (key presses) leave the
+        // image alone. The shader takes no parameters from input yet; events that change any would request a redraw
+        // like a resize.
+        bool RedrawRequested = true;
+        u64 DrawnDamageVersion = 0;
+        u64 IdleWaitCount = 0;
+        auto IsFrameNeeded = [&] {
+            return !Self.OnDemandRendering || RedrawRequested || SwapchainOutOfDate || Self.Damage.Version != DrawnDamageVersion;
+        };
+        while (!Quit) {
+            if (!IsFrameNeeded()) {
+                Self.WindowEvents.Wait();
+                IdleWaitCount += 1;
+            }
+            Self.Timings.BeginFrame();
+            if (Self.LowLatencyPacing && TotalFrameIndex > 0) {
+                if (Self.PresentWaitEnabled && PresentSwapchain == Self.Swapchain) {
+                    auto WaitResult = Self.DeviceDispatcher->vkWaitForPresentKHR(Self.LogicalDevice, Self.Swapchain, TotalFrameIndex, 100'000'000);
+                    if (WaitResult == VK_ERROR_OUT_OF_DATE_KHR) {
+                        SwapchainOutOfDate = true;
+                    }
+                } else {
+                    Self.DeviceDispatcher->vkWaitSemaphoresKHR(
+                        Self.LogicalDevice,
+                        (VkSemaphoreWaitInfo[]){{
+                            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
                             .pNext = {},
-                            .srcSubresource = VkImageSubresourceLayers{
-                                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
-                                .mipLevel = 0,
-                                .baseArrayLayer = 0,
-                                .layerCount = 1
-                            },
-                            .srcOffsets = {
-                                VkOffset3D{
-                                    .x = 0,
-                                    .y = 0,
-                                    .z = 0
-                                },
-                                VkOffset3D{
-                                    .x = i32(Self.SurfaceCapabilities.currentExtent.width),
-                                    .y = i32(Self.SurfaceCapabilities.currentExtent.height),
-                                    .z = 1
-                                },
-                            },
-                            .dstSubresource = VkImageSubresourceLayers{
-                                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
-                                .mipLevel = 0,
-                                .baseArrayLayer = 0,
-                                .layerCount = 1
+                            .flags = {},
+                            .semaphoreCount = 1,
+                            .pSemaphores = (VkSemaphore[]){ Self.TimelineSemaphore },
+                            .pValues = (u64[]) { TotalFrameIndex },
+                        }},
+                        std::numeric_limits<u64>::max()
+                    );
+                }
+            }
+            if (Self.PresentWaitEnabled) {
+                if (PresentSwapchain != Self.Swapchain) {
+                    PresentSamples.clear();
+                }
+                while (!PresentSamples.empty()) {
+                    auto WaitResult = Self.DeviceDispatcher->vkWaitForPresentKHR(Self.LogicalDevice, Self.Swapchain, PresentSamples.front().PresentId, 0);
+                    if (WaitResult == VK_TIMEOUT) {
+                        break;
+                    }
+                    if (WaitResult == VK_SUCCESS) {
+                        auto PresentLatency = std::chrono::steady_clock::now() - PresentSamples.front().InputTime;
+                        PresentLatencySum += PresentLatency;
+                        PresentLatencyMax = std::max(PresentLatencyMax, PresentLatency);
+                        PresentLatencyCount += 1;
+                    }
+                    PresentSamples.pop_front();
+                }
+            }
+
+            Self.Timings.Mark(FramePhase::Wait);
+            if (Self.Headless && TotalFrameIndex == Self.HeadlessFrameLimit) {
+                break;
+            }
+            // Latency is measured from the oldest input this frame consumes, queueing included.
+            auto InputTime = std::chrono::steady_clock::now();
+            while (auto Event = Self.WindowEvents.Pop()) {
+                InputTime = std::min(InputTime, Event->Time);
+                switch (Event->Type) {
+                case WindowEventType::Quit: {
+                    Quit = true;
+                    break;
+                }
+                case WindowEventType::Resize: {
+                    Self.DrawableExtent = VkExtent2D{u32(Event->Width), u32(Event->Height)};
+                    SwapchainOutOfDate = true;
+                    RedrawRequested = true;
+                    break;
+                }
+                case WindowEventType::KeyDown: {
+                    if (Event->Key == SDLK_F12 && Self.DispatchMode == VkDispatchMode::Profile) {
+                        VkDeviceDispatcher::dumpProfile(stdout);
+                    }
+                    if (Event->Key == SDLK_F11) {
+                        std::println(stdout, "{}", Self.Timings.ToJson());
+                    }
+                    break;
+                }
+                case WindowEventType::Expose: {
+                    // The window system lost what was on screen.
+                    Self.Damage.DamageAll();
+                    break;
+                }
+                case WindowEventType::PipelineReady: {
+                    break;
+                }
+                }
+            }
+            if (Self.ShaderHotReload) {
+                Self.SwapPendingPipeline(TotalFrameIndex);
+            }
+            Self.Timings.Mark(FramePhase::Events);
+            if (!IsFrameNeeded()) {
+                continue;
+            }
+
+            // Everything submitted so far, up to timeline value TotalFrameIndex, may still use the old objects.
+            if (SwapchainOutOfDate) {
+                if (!Self.RecreateVulkanTextures(TotalFrameIndex)) {
+                    Self.WindowEvents.Wait();
+                    continue;
+                }
+                SwapchainOutOfDate = false;
+            }
+            Self.Timings.Mark(FramePhase::Acquire);
+
+            u64 L1DMissesAtFrameStart = L1DMissCounter ? perf_read(*L1DMissCounter) : 0;
+
+            // Frames up to FramesInFlight behind may still run; FramesInFlight <= FrameSlotCount, so this also frees the
+            // slot of the frame FrameSlotCount back.
+            auto SlotWaitStart = std::chrono::steady_clock::now();
+            if (TotalFrameIndex >= Self.FramesInFlight) {
+                Self.DeviceDispatcher->vkWaitSemaphoresKHR(
+                    Self.LogicalDevice,
+                    (VkSemaphoreWaitInfo[]){{
+                        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+                        .pNext = {},
+                        .flags = {},
+                        .semaphoreCount = 1,
+                        .pSemaphores = (VkSemaphore[]){ Self.TimelineSemaphore },
+                        .pValues = (u64[]) { TotalFrameIndex - Self.FramesInFlight + 1 },
+                    }},
+                    std::numeric_limits<u64>::max()
+                );
+            }
+            Self.AdaptFramesInFlight(std::chrono::steady_clock::now() - SlotWaitStart);
+            Self.ReadGpuScopes(FrameIndex);
+            Self.StepWorkgroupTuning(FrameIndex, TotalFrameIndex);
+            Self.UpdateRenderExtent();
+            if (!Self.RetiredTextureSets.empty() || !Self.RetiredPipelines.empty()) {
+                u64 CompletedValue;
+                Self.DeviceDispatcher->vkGetSemaphoreCounterValueKHR(Self.LogicalDevice, Self.TimelineSemaphore, &CompletedValue);
+                Self.DeleteRetiredTextures(CompletedValue);
+                Self.DeleteRetiredPipelines(CompletedValue);
+            }
+            Self.Timings.Mark(FramePhase::Wait);
+
+            // Headless images belong to frame slots, so there is nothing to acquire.
+            auto AcquireResult = VK_SUCCESS;
+            if (Self.Headless) {
+                Self.SurfaceImageIndex = FrameIndex;
+            } else {
+                AcquireResult = Self.DeviceDispatcher->vkAcquireNextImage2KHR(
+                    Self.LogicalDevice,
+                    (VkAcquireNextImageInfoKHR[]){{
+                        .sType = VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR,
+                        .pNext = {},
+                        .swapchain = Self.Swapchain,
+                        .timeout = std::numeric_limits<u64>::max(),
+                        .semaphore = Self.AcquireSemaphores[FrameIndex],
+                        .fence = {},
+                        .deviceMask = 1
+                    }},
+                    &Self.SurfaceImageIndex
+                );
+            }
+            // The acquire semaphore is left unsignaled, so the same frame slot can retry with the new swapchain.
+            if (AcquireResult == VK_ERROR_OUT_OF_DATE_KHR) {
+                SwapchainOutOfDate = true;
+                continue;
+            }
+            if (AcquireResult == VK_SUBOPTIMAL_KHR) {
+                SwapchainOutOfDate = true;
+            }
+            Self.Timings.Mark(FramePhase::Acquire);
+            Self.PrepareFrameDamage(FrameIndex, Self.SurfaceImageIndex);
+            VkCommandBuffer CommandBuffer;
+            if (Self.AsyncCompute) {
+                CommandBuffer = Self.CommandBuffers[FrameIndex];
+                Self.RecordAsyncFrameCommands(Self.ComputeCommandBuffers[FrameIndex], CommandBuffer, FrameIndex, Self.SurfaceImageIndex, VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+                Self.Timings.Mark(FramePhase::Record);
+                Self.SubmitGpuScopes(FrameIndex, TotalFrameIndex);
+                Self.DeviceDispatcher->vkQueueSubmit2(
+                    Self.ComputeQueue,
+                    1,
+                    (VkSubmitInfo2[]){{
+                        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+                        .pNext = {},
+                        .flags = {},
+                        .waitSemaphoreInfoCount = 0,
+                        .pWaitSemaphoreInfos = {},
+                        .commandBufferInfoCount = 1,
+                        .pCommandBufferInfos = (VkCommandBufferSubmitInfo[]){{
+                            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+                            .pNext = {},
+                            .commandBuffer = Self.ComputeCommandBuffers[FrameIndex],
+                            .deviceMask = 0
+                        }},
+                        .signalSemaphoreInfoCount = 1,
+                        .pSignalSemaphoreInfos = (VkSemaphoreSubmitInfo[]) {
+                            VkSemaphoreSubmitInfo{
+                                .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+                                .pNext = {},
+                                .semaphore = Self.ComputeTimelineSemaphore,
+                                .value = TotalFrameIndex + 1,
+                                .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
                             },
-                            .dstOffsets = {
-                                VkOffset3D{
-                                    .x = 0,
-                                    .y = 0,
-                                    .z = 0
-                                },
-                                VkOffset3D{
-                                    .x = i32(Self.SurfaceCapabilities.currentExtent.width),
-                                    .y = i32(Self.SurfaceCapabilities.currentExtent.height),
-                                    .z = 1
-                                },
-                            }
                         }
-                    },
-                    .filter = VK_FILTER_NEAREST
-                }}
-            );
-            Self.DeviceDispatcher->vkCmdPipelineBarrier2(
-                Self.CommandBuffers[FrameIndex],
-                (VkDependencyInfo[]) {{
-                    .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+                    }},
+                    nullptr
+                );
+                Self.Timings.Mark(FramePhase::Submit);
+            } else if (Self.PrerecordCommands && !Self.WorkgroupTuning) {
+                // Tuning switches pipelines every few frames, so its frames are recorded as they go below rather than
+                // re-recording the prerecorded buffers per candidate; the winner is recorded once per slot.
+                if (Self.RecordedPipelines[FrameIndex] != Self.ComputePipeline) {
+                    // The slot's buffers are only submitted from this slot, and its previous frame has completed.
+                    // Slots still holding the old pipeline are re-recorded when their turn comes, before they are
+                    // submitted again, so it does not matter if it is destroyed before then.
+                    Self.DeviceDispatcher->vkResetCommandPool(Self.LogicalDevice, Self.RecordedCommandPools[FrameIndex], VkCommandPoolResetFlags());
+                    Self.RecordSlotCommandBuffers(FrameIndex);
+                }
+                CommandBuffer = Self.RecordedCommandBuffers[FrameIndex * Self.SurfaceImageCount + Self.SurfaceImageIndex];
+            } else if (Self.RecordSecondaryCommands) {
+                CommandBuffer = Self.CommandBuffers[FrameIndex];
+                Self.RecordSecondaryFrameCommands(CommandBuffer, FrameIndex, Self.SurfaceImageIndex);
+            } else {
+                CommandBuffer = Self.CommandBuffers[FrameIndex];
+                Self.RecordFrameCommands(CommandBuffer, FrameIndex, Self.SurfaceImageIndex, VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+            }
+            Self.Timings.Mark(FramePhase::Record);
+            if (!Self.AsyncCompute) {
+                Self.SubmitGpuScopes(FrameIndex, TotalFrameIndex);
+            }
+            // Headless frames have no image to acquire; the compute timeline is only waited for with async compute.
+            Self.SubmitWaitSemaphores.clear();
+            if (!Self.Headless) {
+                Self.SubmitWaitSemaphores.push_back(VkSemaphoreSubmitInfo{
+                    .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
                     .pNext = {},
-                    .dependencyFlags = {},
-                    .imageMemoryBarrierCount = 1,
-                    .pImageMemoryBarriers = (VkImageMemoryBarrier2[]) {
-                        VkImageMemoryBarrier2{
-                            .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
-                            .srcStageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
-                            .srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT,
-                            .dstStageMask = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT,
-                            .dstAccessMask = VK_ACCESS_2_NONE,
-                            .oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                            .newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
-                            .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                            .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
-                            .image = Self.SurfaceImages[Self.SurfaceImageIndex],
-                            .subresourceRange = VkImageSubresourceRange{
-                                .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
-                                .baseMipLevel = 0,
-                                .levelCount = 1,
-                                .baseArrayLayer = 0,
-                                .layerCount = 1
-                            }
-                        }
-                    }
-                }}
-            );
-            Self.DeviceDispatcher->vkEndCommandBuffer(Self.CommandBuffers[FrameIndex]);
+                    .semaphore = Self.AcquireSemaphores[FrameIndex],
+                    .stageMask = Self.DirectSwapchainOutput ? VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT : VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                });
+            }
+            if (Self.AsyncCompute) {
+                Self.SubmitWaitSemaphores.push_back(VkSemaphoreSubmitInfo{
+                    .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+                    .pNext = {},
+                    .semaphore = Self.ComputeTimelineSemaphore,
+                    .value = TotalFrameIndex + 1,
+                    .stageMask = VK_PIPELINE_STAGE_2_TRANSFER_BIT,
+                });
+            }
             Self.DeviceDispatcher->vkQueueSubmit2(
                 Self.Queue,
                 1,
@@ -839,46 +3241,60 @@ struct VulkanApplication {
                     .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
                     .pNext = {},
                     .flags = {},
-                    .waitSemaphoreInfoCount = 1,
-                    .pWaitSemaphoreInfos = (VkSemaphoreSubmitInfo[]) {
-                        VkSemaphoreSubmitInfo{
-                            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-                            .pNext = {},
-                            .semaphore = Self.AcquireSemaphores[FrameIndex],
-                            .stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
-                        }
-                    },
+                    .waitSemaphoreInfoCount = u32(Self.SubmitWaitSemaphores.size()),
+                    .pWaitSemaphoreInfos = Self.SubmitWaitSemaphores.data(),
                     .commandBufferInfoCount = 1,
                     .pCommandBufferInfos = (VkCommandBufferSubmitInfo[]){{
                         .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
                         .pNext = {},
-                        .commandBuffer = Self.CommandBuffers[FrameIndex],
+                        .commandBuffer = CommandBuffer,
                         .deviceMask = 0
                     }},
-                    .signalSemaphoreInfoCount = 2,
+                    // Headless frames are not presented, so only the timeline is signaled.
+                    .signalSemaphoreInfoCount = Self.Headless ? 1u : 2u,
                     .pSignalSemaphoreInfos = (VkSemaphoreSubmitInfo[]) {
                         VkSemaphoreSubmitInfo{
                             .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
                             .pNext = {},
-                            .semaphore = Self.SubmitSemaphores[FrameIndex],
-                            .stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                            .semaphore = Self.TimelineSemaphore,
+                            .value = TotalFrameIndex + 1,
+                            .stageMask = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT,
                         },
                         VkSemaphoreSubmitInfo{
                             .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
                             .pNext = {},
-                            .semaphore = Self.TimelineSemaphore,
-                            .value = TotalFrameIndex + 1,
-                            .stageMask = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT,
+                            .semaphore = Self.SubmitSemaphores[FrameIndex],
+                            .stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
                         },
                     }
                 }},
                 nullptr
             );
-            Self.DeviceDispatcher->vkQueuePresentKHR(
+            Self.Timings.Mark(FramePhase::Submit);
+            // Without damage tracking every present replaces the whole image, which is what no regions mean.
+            bool PresentRegionsEnabled = Self.IncrementalPresentEnabled && Self.IncrementalDamage;
+            auto PresentRegion = VkPresentRegionKHR{
+                .rectangleCount = u32(Self.PresentRectangles.size()),
+                .pRectangles = Self.PresentRectangles.data()
+            };
+            auto PresentRegions = VkPresentRegionsKHR{
+                .sType = VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR,
+                .pNext = {},
+                .swapchainCount = 1,
+                .pRegions = &PresentRegion
+            };
+            auto PresentResult = Self.Headless ? VK_SUCCESS : Self.DeviceDispatcher->vkQueuePresentKHR(
                 Self.Queue,
                 (VkPresentInfoKHR[]) {{
                     .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
-                    .pNext = {},
+                    .pNext = Self.PresentWaitEnabled ? (VkPresentIdKHR[]){{
+                        .sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+                        .pNext = PresentRegionsEnabled ? &PresentRegions : nullptr,
+                        .swapchainCount = 1,
+                        .pPresentIds = (u64[]) {
+                            TotalFrameIndex + 1
+                        }
+                    }} : PresentRegionsEnabled ? static_cast<void const*>(&PresentRegions) : nullptr,
                     .waitSemaphoreCount = 1,
                     .pWaitSemaphores = (VkSemaphore[]) {
                         Self.SubmitSemaphores[FrameIndex]
@@ -893,12 +3309,83 @@ struct VulkanApplication {
                     .pResults = {}
                 }}
             );
+            if (PresentResult == VK_ERROR_OUT_OF_DATE_KHR || PresentResult == VK_SUBOPTIMAL_KHR) {
+                SwapchainOutOfDate = true;
+            }
+            if (Self.PresentWaitEnabled) {
+                PresentSwapchain = Self.Swapchain;
+                PresentSamples.push_back(PresentSample{
+                    .PresentId = TotalFrameIndex + 1,
+                    .InputTime = InputTime
+                });
+            }
+            Self.Timings.Mark(FramePhase::Present);
+            Self.Timings.EndFrame();
+            RedrawRequested = false;
+            DrawnDamageVersion = Self.Damage.Version;
+            if (L1DMissCounter) {
+                L1DMisses += perf_read(*L1DMissCounter) - L1DMissesAtFrameStart;
+            }
             TotalFrameIndex += 1;
             FrameIndex += 1;
-            FrameIndex %= MAX_FRAMES_IN_FLIGHT;
+            FrameIndex %= Self.FrameSlotCount;
+        }
+
+        if (Self.OnDemandRendering) {
+            std::println(stdout, "[info]: rendered {} frames on demand in {:.1f} s, idle {} times", TotalFrameIndex, std::chrono::duration<f64>(std::chrono::steady_clock::now() - LoopStartTime).count(), IdleWaitCount);
+        }
+        if (L1DMissCounter) {
+            std::println(stdout, "[info]: {} L1D read misses per frame over {} frames", L1DMisses / std::max(TotalFrameIndex, 1u), TotalFrameIndex);
+            perf_close(*L1DMissCounter);
+        }
+        if (PresentLatencyCount != 0) {
+            std::println(stdout, "[info]: input-to-present latency ({}, {} images, {} pacing): mean {:.2f} ms, max {:.2f} ms over {} frames",
+                PRESENT_MODE_NAMES[Self.PresentMode],
+                Self.SurfaceMinImageCount,
+                Self.LowLatencyPacing ? "low-latency" : "throughput",
+                std::chrono::duration<f64, std::milli>(PresentLatencySum).count() / f64(PresentLatencyCount),
+                std::chrono::duration<f64, std::milli>(PresentLatencyMax).count(),
+                PresentLatencyCount
+            );
+        }
+
+        // KOMPUTE_FRAME_TIMINGS=path also writes the final statistics as JSON, the same document F11 prints.
+        Self.Timings.PrintSummary(stdout);
+        if (auto TimingsPath = env_read_string("KOMPUTE_FRAME_TIMINGS")) {
+            if (auto Stream = std::ofstream(std::string(*TimingsPath)); Stream.is_open()) {
+                Stream << Self.Timings.ToJson() << '\n';
+            } else {
+                std::println(stderr, "[warning]: failed to write frame timings to '{}'", *TimingsPath);
+            }
         }
 
         Self.DeviceDispatcher->vkDeviceWaitIdle(Self.LogicalDevice);
+        for (u32 i = 0; i < Self.FrameSlotCount; i += 1) {
+            Self.ReadGpuScopes(i);
+        }
+        for (u32 i = 0; i < std::size(GPU_SCOPE_NAMES); i += 1) {
+            if (Self.GpuScopeSamples[i] != 0) {
+                std::println(stdout, "[info]: GPU {}: mean {:.3f} ms over {} frames", GPU_SCOPE_NAMES[i], Self.GpuScopeMilliseconds[i] / f64(Self.GpuScopeSamples[i]), Self.GpuScopeSamples[i]);
+            }
+        }
+        if (auto TracePath = env_read_string("KOMPUTE_GPU_TRACE")) {
+            if (Self.Trace.Write(std::string(*TracePath))) {
+                std::println(stdout, "[info]: wrote {} trace events to '{}'", Self.Trace.Events.size(), *TracePath);
+            } else {
+                std::println(stderr, "[warning]: failed to write the trace to '{}'", *TracePath);
+            }
+        }
+        if (Self.Headless) {
+            auto LoopSeconds = std::chrono::duration<f64>(std::chrono::steady_clock::now() - LoopStartTime).count();
+            std::println(stdout, "[info]: headless: {} frames at {}x{} in {:.3f} s, {:.1f} frames/s, {:.3f} ms/frame",
+                TotalFrameIndex,
+                Self.HeadlessExtent.width,
+                Self.HeadlessExtent.height,
+                LoopSeconds,
+                f64(TotalFrameIndex) / LoopSeconds,
+                LoopSeconds * 1000.0 / f64(std::max(TotalFrameIndex, 1u))
+            );
+        }
     }
 
     static VKAPI_ATTR auto VKAPI_CALL DebugUtilsCallback(VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT messageTypes, VkDebugUtilsMessengerCallbackDataEXT const* pCallbackData, void* pUserData) -> VkBool32 {
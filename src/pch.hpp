@@ -106,6 +106,9 @@
 #ifdef __cpp_lib_syncstream
     #include <syncstream>
 #endif
+#ifdef __cpp_lib_print
+    #include <print>
+#endif
 #include <filesystem>
 #include <regex>
 #include <atomic>
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "pch.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Opens a counter of L1D read misses in user space for the calling thread.
+static auto perf_open_l1d_read_misses() -> std::optional<i32> {
+#if defined(__linux__)
+    auto attributes = perf_event_attr{
+        .type = PERF_TYPE_HW_CACHE,
+        .size = sizeof(perf_event_attr),
+        .config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+        .exclude_kernel = 1,
+        .exclude_hv = 1,
+    };
+    if (auto fd = i32(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0)); fd != -1) {
+        return fd;
+    }
+#endif
+    return std::nullopt;
+}
+
+static auto perf_read(i32 fd) -> u64 {
+    u64 value = 0;
+#if defined(__linux__)
+    if (read(fd, &value, sizeof(value)) != sizeof(value)) {
+        return 0;
+    }
+#endif
+    return value;
+}
+
+static void perf_close(i32 fd) {
+#if defined(__linux__)
+    close(fd);
+#endif
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "pch.hpp"
+
+// The per-axis render scale stays in [MIN_RENDER_SCALE, 1]. GPU frame times within the deadband around the budget
+// leave the scale alone, and the smoothing factor weighs each new sample into the running average.
+static constexpr f64 MIN_RENDER_SCALE = 0.25;
+static constexpr f64 RENDER_SCALE_DEADBAND = 0.05;
+static constexpr f64 GPU_FRAME_TIME_SMOOTHING = 0.2;
+
+// Picks the render scale whose GPU frame time meets BudgetMilliseconds. The pixel count, and so roughly the GPU time,
+// goes with the square of the scale. Each step moves the scale half way (in log space) towards the one that would meet
+// the budget, which damps the lag of reading frames behind.
+struct RenderScaleController {
+    f64 BudgetMilliseconds = 0.0;
+    f64 FrameMilliseconds = 0.0;
+    f64 Scale = 1.0;
+
+    // Called with the GPU time of each completed frame. A frame that dispatched nothing, because none of the image
+    // changed, costs next to nothing at any scale; counting it would raise the scale, and the redraw of the whole
+    // render area that a new scale causes would pull it back down, over and over. Such frames are left out.
+    void Update(this RenderScaleController& Self, f64 GpuFrameMilliseconds, bool Dispatched) {
+        if (!Dispatched) {
+            return;
+        }
+        Self.FrameMilliseconds = Self.FrameMilliseconds == 0.0 ? GpuFrameMilliseconds : std::lerp(Self.FrameMilliseconds, GpuFrameMilliseconds, GPU_FRAME_TIME_SMOOTHING);
+        auto BudgetRatio = Self.BudgetMilliseconds / Self.FrameMilliseconds;
+        if (std::abs(BudgetRatio - 1.0) > RENDER_SCALE_DEADBAND) {
+            Self.Scale = std::clamp(Self.Scale * std::pow(BudgetRatio, 0.25), MIN_RENDER_SCALE, 1.0);
+        }
+    }
+};
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "pch.hpp"
+
+// Lock-free ring for one producer thread and one consumer thread. Head is only written by the consumer and Tail only
+// by the producer, each on its own cache line, so neither side ever takes a lock.
+template<typename T, u32 Capacity>
+struct SpscQueue {
+    static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+    alignas(64) std::atomic<u32> Head = 0;
+    alignas(64) std::atomic<u32> Tail = 0;
+    alignas(64) T Items[Capacity];
+
+    // Producer only. Returns false while the queue is full.
+    auto Push(this SpscQueue& Self, T const& Item) -> bool {
+        u32 Tail = Self.Tail.load(std::memory_order_relaxed);
+        if (Tail - Self.Head.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        Self.Items[Tail & (Capacity - 1)] = Item;
+        Self.Tail.store(Tail + 1, std::memory_order_release);
+        Self.Tail.notify_one();
+        return true;
+    }
+
+    // Consumer only.
+    auto Pop(this SpscQueue& Self) -> std::optional<T> {
+        u32 Head = Self.Head.load(std::memory_order_relaxed);
+        if (Head == Self.Tail.load(std::memory_order_acquire)) {
+            return std::nullopt;
+        }
+        auto Item = Self.Items[Head & (Capacity - 1)];
+        Self.Head.store(Head + 1, std::memory_order_release);
+        return Item;
+    }
+
+    // Consumer only. Blocks until there is something to pop.
+    void Wait(this SpscQueue& Self) {
+        Self.Tail.wait(Self.Head.load(std::memory_order_relaxed), std::memory_order_acquire);
+    }
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "pch.hpp"
+
+// A rectangle of tiles, in tile units.
+struct TileRect {
+    u32 X;
+    u32 Y;
+    u32 Width;
+    u32 Height;
+};
+
+// Damage on a grid of TileWidth x TileHeight tiles. Every tile keeps the version of its last change and every image
+// that shows the content keeps the version it was last brought up to, so an image is redrawn in exactly the tiles
+// that changed since it was last drawn, however many frames ago that was. Images start at version 0, which is older
+// than any tile. The shader draws the whole image from its size alone, so every change so far (a resize, an expose, a
+// reloaded pipeline, a tuning step) damages all of it, and an image is either redrawn whole or not at all.
+struct TileDamage {
+    u32 TileWidth = 0;
+    u32 TileHeight = 0;
+    u32 Columns = 0;
+    u32 Rows = 0;
+    u64 Version = 0;
+    std::vector<u64> TileVersions;
+    std::vector<u32> OpenRects;
+    std::vector<u32> NextOpenRects;
+
+    // Resizes the grid to cover Width x Height pixels and damages all of it.
+    void Reset(this TileDamage& Self, u32 Width, u32 Height, u32 TileWidth, u32 TileHeight) {
+        Self.TileWidth = TileWidth;
+        Self.TileHeight = TileHeight;
+        Self.Columns = (Width + TileWidth - 1) / TileWidth;
+        Self.Rows = (Height + TileHeight - 1) / TileHeight;
+        Self.Version += 1;
+        Self.TileVersions.assign(usize(Self.Columns) * usize(Self.Rows), Self.Version);
+    }
+
+    void DamageAll(this TileDamage& Self) {
+        Self.Version += 1;
+        std::ranges::fill(Self.TileVersions, Self.Version);
+    }
+
+    // Replaces Rects with the tiles changed after SinceVersion: runs of dirty tiles along a row, each merged into the
+    // rectangle above it when that one spans exactly the same columns. More than MaxRects rectangles collapse into
+    // their bounding rectangle, which bounds the per-rectangle cost of dispatches, blit regions and present regions.
+    void Collect(this TileDamage& Self, u64 SinceVersion, u32 MaxRects, std::vector<TileRect>& Rects) {
+        Rects.clear();
+        Self.OpenRects.clear();
+        for (u32 Row = 0; Row < Self.Rows; Row += 1) {
+            Self.NextOpenRects.clear();
+            // Runs and open rectangles are both ordered by column, so they are matched in a single pass.
+            usize Open = 0;
+            u32 Column = 0;
+            while (Column < Self.Columns) {
+                if (Self.TileVersions[usize(Row) * Self.Columns + Column] <= SinceVersion) {
+                    Column += 1;
+                    continue;
+                }
+                u32 RunBegin = Column;
+                while (Column < Self.Columns && Self.TileVersions[usize(Row) * Self.Columns + Column] > SinceVersion) {
+                    Column += 1;
+                }
+                while (Open < Self.OpenRects.size() && Rects[Self.OpenRects[Open]].X < RunBegin) {
+                    Open += 1;
+                }
+                if (Open < Self.OpenRects.size() && Rects[Self.OpenRects[Open]].X == RunBegin && Rects[Self.OpenRects[Open]].Width == Column - RunBegin) {
+                    Rects[Self.OpenRects[Open]].Height += 1;
+                    Self.NextOpenRects.push_back(Self.OpenRects[Open]);
+                } else {
+                    Self.NextOpenRects.push_back(u32(Rects.size()));
+                    Rects.push_back(TileRect{
+                        .X = RunBegin,
+                        .Y = Row,
+                        .Width = Column - RunBegin,
+                        .Height = 1
+                    });
+                }
+            }
+            std::swap(Self.OpenRects, Self.NextOpenRects);
+        }
+        if (Rects.size() > MaxRects) {
+            auto Bounds = Rects.front();
+            for (auto const& Rect : Rects) {
+                u32 Right = std::max(Bounds.X + Bounds.Width, Rect.X + Rect.Width);
+                u32 Bottom = std::max(Bounds.Y + Bounds.Height, Rect.Y + Rect.Height);
+                Bounds.X = std::min(Bounds.X, Rect.X);
+                Bounds.Y = std::min(Bounds.Y, Rect.Y);
+                Bounds.Width = Right - Bounds.X;
+                Bounds.Height = Bottom - Bounds.Y;
+            }
+            Rects.assign(1, Bounds);
+        }
+    }
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "pch.hpp"
+
+// Fork-join pool for per-frame work. Run() hands the job to every worker thread, runs it as worker 0 on the calling
+// thread and returns once all workers are done with it. The pool must not move while its threads are running.
+struct WorkerPool {
+    std::vector<std::thread> Threads;
+    std::mutex Mutex;
+    std::condition_variable WorkReady;
+    std::condition_variable WorkDone;
+    void (*Invoke)(void*, u32) = nullptr;
+    void* Context = nullptr;
+    u64 Generation = 0;
+    u32 Pending = 0;
+    bool Stopping = false;
+
+    // WorkerCount includes the calling thread.
+    void Start(this WorkerPool& Self, u32 WorkerCount) {
+        for (u32 Worker = 1; Worker < WorkerCount; Worker += 1) {
+            Self.Threads.emplace_back([&Self, Worker] {
+                Self.Work(Worker);
+            });
+        }
+    }
+
+    void Stop(this WorkerPool& Self) {
+        {
+            auto Lock = std::unique_lock(Self.Mutex);
+            Self.Stopping = true;
+        }
+        Self.WorkReady.notify_all();
+        for (auto& Thread : Self.Threads) {
+            Thread.join();
+        }
+        Self.Threads.clear();
+    }
+
+    auto WorkerCount(this WorkerPool const& Self) -> u32 {
+        return u32(Self.Threads.size()) + 1;
+    }
+
+    // Job is called as Job(u32 Worker) once on every worker.
+    template<typename Fn>
+    void Run(this WorkerPool& Self, Fn&& Job) {
+        if (Self.Threads.empty()) {
+            Job(0u);
+            return;
+        }
+        {
+            auto Lock = std::unique_lock(Self.Mutex);
+            Self.Invoke = [](void* Context, u32 Worker) {
+                (*static_cast<std::remove_reference_t<Fn>*>(Context))(Worker);
+            };
+            Self.Context = &Job;
+            Self.Pending = u32(Self.Threads.size());
+            Self.Generation += 1;
+        }
+        Self.WorkReady.notify_all();
+        Job(0u);
+        auto Lock = std::unique_lock(Self.Mutex);
+        Self.WorkDone.wait(Lock, [&Self] {
+            return Self.Pending == 0;
+        });
+    }
+
+    void Work(this WorkerPool& Self, u32 Worker) {
+        u64 Generation = 0;
+        auto Lock = std::unique_lock(Self.Mutex);
+        while (true) {
+            Self.WorkReady.wait(Lock, [&] {
+                return Self.Stopping || Self.Generation != Generation;
+            });
+            if (Self.Stopping) {
+                return;
+            }
+            Generation = Self.Generation;
+            auto Invoke = Self.Invoke;
+            auto Context = Self.Context;
+            Lock.unlock();
+            Invoke(Context, Worker);
+            Lock.lock();
+            Self.Pending -= 1;
+            if (Self.Pending == 0) {
+                Self.WorkDone.notify_one();
+            }
+        }
+    }
+};
@@ -0,0 +1,54 @@
+#include "frames_in_flight.hpp"
+
+// Wait share of a loop whose CPU takes CpuMilliseconds and GPU GpuMilliseconds per frame: one frame in flight runs
+// them back to back, and deeper queues overlap them, so only a GPU slower than the CPU makes the loop wait.
+static auto WaitShare(u32 Depth, f64 CpuMilliseconds, f64 GpuMilliseconds) -> f64 {
+    if (Depth == 1) {
+        return GpuMilliseconds / (CpuMilliseconds + GpuMilliseconds);
+    }
+    return std::max(0.0, GpuMilliseconds - CpuMilliseconds) / std::max(CpuMilliseconds, GpuMilliseconds);
+}
+
+// A GPU at half the CPU time waits a third of the frame at depth 1 and nothing at depth 2, so the depth has to end
+// up at 2 instead of flipping between the two every window.
+static auto DepthDependentWaitSettles() -> bool {
+    auto Controller = FramesInFlightController{.MaxDepth = 3, .Depth = 3};
+    u32 Changes = 0;
+    u32 ShallowWindows = 0;
+    for (u32 Window = 0; Window < 10'000; Window += 1) {
+        Changes += Controller.Update(WaitShare(Controller.Depth, 10.0, 5.0)) ? 1 : 0;
+        ShallowWindows += Window >= 1'000 && Controller.Depth == 1 ? 1 : 0;
+    }
+    return Changes < 2 * (10'000 / ADAPTIVE_FRAMES_IN_FLIGHT_MAX_LOWER_HOLD_WINDOWS + 8) && ShallowWindows < 9'000 / 50;
+}
+
+// A GPU that keeps up at any depth brings the depth down to 1 and leaves it there.
+static auto IdleGpuLowersDepth() -> bool {
+    auto Controller = FramesInFlightController{.MaxDepth = 3, .Depth = 3};
+    u32 Changes = 0;
+    for (u32 Window = 0; Window < 1'000; Window += 1) {
+        Changes += Controller.Update(WaitShare(Controller.Depth, 10.0, 0.1)) ? 1 : 0;
+    }
+    return Controller.Depth == 1 && Changes == 2;
+}
+
+// A GPU slower than the CPU raises the depth to the number of slots and keeps it there.
+static auto BusyGpuRaisesDepth() -> bool {
+    auto Controller = FramesInFlightController{.MaxDepth = 3, .Depth = 1};
+    u32 Changes = 0;
+    for (u32 Window = 0; Window < 1'000; Window += 1) {
+        Changes += Controller.Update(WaitShare(Controller.Depth, 5.0, 10.0)) ? 1 : 0;
+    }
+    return Controller.Depth == 3 && Changes == 2;
+}
+
+auto main() -> int {
+    auto Failures = 0;
+    for (auto [Name, Test] : {std::pair{"depth-dependent wait settles", &DepthDependentWaitSettles}, std::pair{"idle GPU lowers the depth", &IdleGpuLowersDepth}, std::pair{"busy GPU raises the depth", &BusyGpuRaisesDepth}}) {
+        if (!Test()) {
+            std::println(stderr, "[error]: {} failed", Name);
+            Failures += 1;
+        }
+    }
+    return Failures == 0 ? 0 : 1;
+}
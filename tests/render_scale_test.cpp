@@ -0,0 +1,33 @@
+#include "render_scale.hpp"
+
+// Damage tracking on static content: one redraw of the whole render area over budget, then frames that dispatch
+// nothing. The scale drops once and stays there.
+static auto StaticContentHoldsScale() -> bool {
+    auto Controller = RenderScaleController{.BudgetMilliseconds = 8.0};
+    Controller.Update(16.0, true);
+    auto Scale = Controller.Scale;
+    for (u32 i = 0; i < 1000; i += 1) {
+        Controller.Update(0.05, false);
+    }
+    return Scale < 1.0 && Controller.Scale == Scale;
+}
+
+// Frames that dispatch keep steering the scale towards the budget.
+static auto DispatchedFramesMoveScale() -> bool {
+    auto Controller = RenderScaleController{.BudgetMilliseconds = 8.0};
+    for (u32 i = 0; i < 1000; i += 1) {
+        Controller.Update(32.0 * Controller.Scale * Controller.Scale, true);
+    }
+    return std::abs(Controller.Scale - 0.5) < 0.05;
+}
+
+auto main() -> int {
+    auto Failures = 0;
+    for (auto [Name, Test] : {std::pair{"static content holds the scale", &StaticContentHoldsScale}, std::pair{"dispatched frames move the scale", &DispatchedFramesMoveScale}}) {
+        if (!Test()) {
+            std::println(stderr, "[error]: {} failed", Name);
+            Failures += 1;
+        }
+    }
+    return Failures == 0 ? 0 : 1;
+}